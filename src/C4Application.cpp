@@ -24,6 +24,7 @@
 #include <C4UpdateDlg.h>
 #endif
 
+#include <C4Benchmark.h>
 #include <C4FileClasses.h>
 #include <C4FullScreen.h>
 #include <C4Language.h>
@@ -48,7 +49,8 @@ C4Application::C4Application() :
 	isFullScreen(true), UseStartupDialog(true), launchEditor(false), restartAtEnd(false),
 	DDraw(nullptr), AppState(C4AS_None), pSec1TimerCallback(nullptr),
 	iLastGameTick(0), iGameTickDelay(defaultGameTickDelay), iExtraGameTickDelay(0), pGamePadControl(nullptr),
-	CheckForUpdates(false) {}
+	CheckForUpdates(false),
+	BenchmarkFailed(false) {}
 
 C4Application::~C4Application()
 {
@@ -106,6 +108,8 @@ bool C4Application::DoInit()
 	C4Group_SetMaker(Config.General.Name);
 	C4Group_SetProcessCallback(&ProcessCallback);
 	C4Group_SetTempPath(Config.General.TempPath);
+	C4Group_SetCompressionThreads(Config.General.WorkerThreads);
+	if (Config.General.GroupCache) C4Group_SetCachePath(Config.AtTempPath("GroupCache"), static_cast<uint64_t>(std::max(Config.General.GroupCacheSize, 0)) << 20);
 	C4Group_SetSortList(C4CFN_FLS);
 
 	// Open log
@@ -208,6 +212,13 @@ bool C4Application::PreInit()
 {
 	SetGameTickDelay(defaultGameTickDelay);
 
+	// benchmarks replace the game; quit when they are done
+	if (Benchmark)
+	{
+		BenchmarkFailed = !C4Benchmark::Run(Benchmark.getData());
+		return false;
+	}
+
 	if (!Game.PreInit()) return false;
 
 	// startup dialog: Only use if no next mission has been provided
@@ -251,6 +262,8 @@ void C4Application::Clear()
 {
 	Game.Clear();
 	NextMission.Clear();
+	// stop worker threads
+	ThreadPool.Clear();
 	// close system group (System.c4g)
 	SystemGroup.Close();
 	// Close timers
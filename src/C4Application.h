@@ -23,6 +23,7 @@
 #include <C4Components.h>
 #include <C4InteractiveThread.h>
 #include <C4Network2IRC.h>
+#include <C4ThreadPool.h>
 #include <StdWindow.h>
 
 class CStdDDraw;
@@ -84,6 +85,10 @@ public:
 	StdStrBuf IncomingUpdate;
 	// set by ParseCommandLine, for manually invoking an update check by command line or url
 	bool CheckForUpdates;
+	// set by ParseCommandLine, benchmarks to run instead of starting the game
+	StdStrBuf Benchmark;
+	// set if one of those benchmarks failed; the engine then exits with an error code
+	bool BenchmarkFailed;
 	// Flag for launching editor on quit
 	bool launchEditor;
 	// Flag for restarting the engine at the end
@@ -95,6 +100,8 @@ public:
 	C4GamePadControl *pGamePadControl;
 	// Thread for interactive processes (automatically starts as needed)
 	C4InteractiveThread InteractiveThread;
+	// Worker threads for data-parallel engine tasks (automatically started as needed)
+	C4ThreadPool ThreadPool;
 	// IRC client for global chat
 	C4Network2IRCClient IRCClient;
 	// Tick timing
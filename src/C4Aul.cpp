@@ -23,8 +23,11 @@
 #include <C4Config.h>
 #include <C4Def.h>
 #include <C4Log.h>
+#include <C4Profiler.h>
 #include <C4Components.h>
 
+int32_t C4AulCallCache::Generation = 0;
+
 C4AulError::C4AulError() {}
 
 void C4AulError::show()
@@ -172,6 +175,13 @@ StdStrBuf C4AulScriptFunc::GetFullName()
 	return sResult;
 }
 
+const char *C4AulScriptFunc::GetProfilerName()
+{
+	// the name is kept by the profiler, so it stays valid for the trace even if this function is deleted
+	if (!ProfilerName) ProfilerName = C4Profiler::InternName(*Name ? GetFullName().getData() : C4AUL_DirectExecName);
+	return ProfilerName;
+}
+
 C4AulScript::C4AulScript()
 {
 	// init defaults
@@ -185,6 +195,7 @@ void C4AulScript::Default()
 	Script.Clear();
 	Code = CPos = nullptr;
 	CodeSize = CodeBufSize = 0;
+	CallCaches = nullptr;
 	IncludesResolved = false;
 
 	// defaults
@@ -230,12 +241,31 @@ void C4AulScript::Clear()
 	while (Func0) delete Func0;
 	// delete script+code
 	Script.Clear();
-	delete[] Code; Code = nullptr;
-	CodeSize = CodeBufSize = 0;
+	ClearCode();
 	// reset flags
 	State = ASS_NONE;
 }
 
+void C4AulScript::ClearCode()
+{
+	delete[] Code; Code = CPos = nullptr;
+	CodeSize = CodeBufSize = 0;
+	// delete call site caches
+	while (CallCaches)
+	{
+		C4AulCallCache *pNext = CallCaches->Next;
+		delete CallCaches;
+		CallCaches = pNext;
+	}
+	// functions may be gone now, so no cache anywhere may be trusted anymore
+	C4AulCallCache::InvalidateAll();
+}
+
+C4AulCallCache *C4AulScript::AddCallCache(C4AulFunc *pFunc)
+{
+	return CallCaches = new C4AulCallCache(pFunc, CallCaches);
+}
+
 void C4AulScript::Reg2List(C4AulScriptEngine *pEngine, C4AulScript *pOwner)
 {
 	// already regged? (def reloaded)
@@ -438,7 +468,7 @@ void C4AulScript::AddFunc(const char *pIdtf, C4ScriptFnDef *Def)
 // C4AulScriptEngine
 
 C4AulScriptEngine::C4AulScriptEngine() :
-	warnCnt(0), errCnt(0), nonStrictCnt(0), lineCnt(0)
+	warnCnt(0), errCnt(0), nonStrictCnt(0), lineCnt(0), Superinstructions(true)
 {
 	// /me r b engine
 	Engine = this;
@@ -30,6 +30,11 @@
 #include <C4Script.h>
 #include <C4StringTable.h>
 
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
 // class predefs
 class C4AulError;
 class C4AulFunc;
@@ -40,12 +45,15 @@ class C4AulScriptEngine;
 
 struct C4AulContext;
 struct C4AulBCC;
+struct C4AulProfilerNode;
 
 // consts
 #define C4AUL_MAX_String 1024 // max string length
 #define C4AUL_MAX_Identifier 100 // max length of function identifiers
 #define C4AUL_MAX_Par 10 // max number of parameters
 
+#define C4AUL_DirectExecName "Direct exec" // profiler name of DirectExec-functions
+
 #define C4AUL_ControlMethod_None 0
 #define C4AUL_ControlMethod_Classic 1
 #define C4AUL_ControlMethod_JumpAndRun 2
@@ -208,6 +216,11 @@ enum C4AulBCCType
 	AB_ERR,              // parse error at this position
 	AB_EOFN,             // end of function
 	AB_EOF,              // end of file
+
+	// superinstructions (combined from common sequences after parsing; the original chunks stay in place behind them)
+	AB_VARN_V_INT_CMP_CONDN, // AB_VARN_V, AB_INT, comparison, AB_CONDN
+	AB_VARN_R_INC1_STACK,    // AB_VARN_R, AB_Inc1(_Postfix), AB_STACK -1
+	AB_PARN_V_FUNC,          // AB_PARN_V, AB_FUNC
 };
 
 // ** a definition of an operator
@@ -235,6 +248,41 @@ struct C4AulBCC
 	const char *SPos;
 };
 
+// inline cache of an object call site (bccX of AB_CALL and AB_CALLFS)
+// remembers the functions resolved for the last few target definitions, so repeated calls skip the name lookup
+// keyed on the definition, so an object changing its definition just misses the cache
+struct C4AulCallCache
+{
+	static const int32_t Size = 4; // number of definitions remembered per call site
+	static int32_t Generation; // increased whenever script functions may get unlinked or deleted
+
+	C4AulFunc *Func; // function found by the parser
+	int32_t EntryGeneration; // generation the entries were resolved in
+	int32_t Count, NextEntry; // number of used entries; entry to be replaced next
+	C4Def *Defs[Size];
+	C4AulFunc *Funcs[Size]; // resolved functions; nullptr if the definition has no such function
+	C4AulCallCache *Next; // next call site cache of the same script
+
+	C4AulCallCache(C4AulFunc *pFunc, C4AulCallCache *pNext) : Func(pFunc), EntryGeneration(Generation), Count(0), NextEntry(0), Next(pNext) {}
+
+	bool Lookup(C4Def *pDef, C4AulFunc *&rpFunc)
+	{
+		if (EntryGeneration != Generation) { Count = NextEntry = 0; EntryGeneration = Generation; return false; }
+		for (int32_t i = 0; i < Count; ++i)
+			if (Defs[i] == pDef) { rpFunc = Funcs[i]; return true; }
+		return false;
+	}
+
+	void Store(C4Def *pDef, C4AulFunc *pFunc)
+	{
+		Defs[NextEntry] = pDef; Funcs[NextEntry] = pFunc;
+		NextEntry = (NextEntry + 1) % Size;
+		if (Count < Size) ++Count;
+	}
+
+	static void InvalidateAll() { ++Generation; }
+};
+
 // call context
 struct C4AulContext
 {
@@ -253,7 +301,10 @@ struct C4AulScriptContext : public C4AulContext
 	bool TemporaryScript;
 	C4ValueList NumVars;
 	C4AulBCC *CPos;
-	time_t tTime; // initialized only by profiler if active
+	// initialized only by profiler if active
+	uint64_t tTime; // start time in nanoseconds
+	uint64_t tCalleeTime; // time spent in called script functions
+	C4AulProfilerNode *pProfilerNode; // call tree node of this call stack
 
 	int ParCnt() const { return Vars - Pars; }
 	void dump(StdStrBuf Dump = "");
@@ -332,7 +383,7 @@ public:
 
 	C4AulScriptFunc(C4AulScript *pOwner, const char *pName, bool bAtEnd = true) : C4AulFunc(pOwner, pName, bAtEnd),
 		idImage(C4ID_None), iImagePhase(0), Condition(nullptr), ControlMethod(C4AUL_ControlMethod_All), OwnerOverloaded(nullptr),
-		bReturnRef(false), tProfileTime(0)
+		bReturnRef(false), ProfilerName(nullptr)
 	{
 		for (int i = 0; i < C4AUL_MAX_Par; i++) ParType[i] = C4V_Any;
 	}
@@ -349,7 +400,10 @@ public:
 
 	StdStrBuf GetFullName(); // get a fully classified name (C4ID::Name) for debug output
 
-	time_t tProfileTime; // internally set by profiler
+	const char *GetProfilerName(); // full name as zone name for C4Profiler and key for C4AulProfiler
+
+protected:
+	const char *ProfilerName; // interned on first use
 
 	friend class C4AulScript;
 };
@@ -406,29 +460,62 @@ enum C4AulScriptState
 
 #ifdef C4ENGINE
 
-// script profiler entry
+// node of the script profiler call tree: one per distinct call stack
+struct C4AulProfilerNode
+{
+	const char *Name; // function name, see C4AulScriptFunc::GetProfilerName
+	C4AulProfilerNode *Parent;
+	std::vector<std::unique_ptr<C4AulProfilerNode>> Children;
+	uint64_t Calls, InclusiveTime, SelfTime; // times in nanoseconds
+
+	C4AulProfilerNode(const char *szName, C4AulProfilerNode *pParent)
+		: Name(szName), Parent(pParent), Calls(0), InclusiveTime(0), SelfTime(0) {}
+
+	C4AulProfilerNode *GetChild(const char *szName);
+};
+
+// script profiler: call tree with self and inclusive times, executed chunks per script line
 class C4AulProfiler
 {
 private:
-	// map entry
+	// totals of a function
 	struct Entry
 	{
-		C4AulScriptFunc *pFunc;
-		time_t tProfileTime;
+		const char *Name;
+		uint64_t Calls, InclusiveTime, SelfTime;
+
+		bool operator<(const Entry &e2) const { return InclusiveTime < e2.InclusiveTime; }
+	};
 
-		bool operator<(const Entry &e2) const { return tProfileTime < e2.tProfileTime; }
+	// executed chunks of a script line
+	struct LineHits
+	{
+		const char *Script; // nullptr: not resolved yet
+		int32_t Line;
+		uint64_t Hits;
 	};
 
-	// items
-	std::vector<Entry> Times;
+	C4AulProfilerNode Root; // calls from the engine
+	std::unordered_map<const C4AulBCC *, LineHits> ChunkHits;
+	std::unordered_set<const char *> ProfiledFuncs; // names of the functions of the profiled script
+
+	void CollectEntries(C4AulProfilerNode *pNode, std::vector<const char *> &Stack, std::unordered_map<const char *, Entry> &Entries);
+	void WriteStacks(FILE *pFile, C4AulProfilerNode *pNode, StdStrBuf &Stack);
+	bool WriteReport(const char *szFilename, std::vector<Entry> &Entries);
 
 public:
-	void CollectEntry(C4AulScriptFunc *pFunc, time_t tProfileTime);
-	void Show();
+	C4AulProfiler() : Root("(engine)", nullptr) {}
+
+	C4AulProfilerNode *GetRoot() { return &Root; }
+	void CollectFunc(C4AulScriptFunc *pFunc);
+	void HitChunk(const C4AulBCC *pCPos, C4AulScriptFunc *pFunc);
+	uint64_t GetChunkHits() const; // total number of executed chunks
+	void Show(); // logs function totals and writes the detailed report and the collapsed stacks
 
 	static void Abort();
 	static void StartProfiling(C4AulScript *pScript);
 	static void StopProfiling();
+	static uint64_t GetExecutedChunks(); // chunks executed since StartProfiling; 0 if not profiling
 };
 
 #endif
@@ -463,6 +550,7 @@ protected:
 	C4AulScriptState State; // script state
 	int CodeSize; // current number of byte code chunks in Code
 	int CodeBufSize; // size of Code buffer
+	C4AulCallCache *CallCaches; // inline caches of the object calls in Code
 	bool Preparsing; // set while preparse
 	bool Resolving; // set while include-resolving, to catch circular includes
 
@@ -476,6 +564,9 @@ protected:
 	void AddBCC(C4AulBCCType eType, intptr_t = 0, const char *SPos = 0); // add byte code chunk and advance
 	bool Preparse(); // preparse script; return if successfull
 	void ParseFn(C4AulScriptFunc *Fn, bool fExprOnly = false); // parse single script function
+	void CombineInstructions(); // replace common byte code sequences by superinstructions
+	C4AulCallCache *AddCallCache(C4AulFunc *pFunc); // create inline cache for an object call site
+	void ClearCode(); // delete byte code and call site caches
 
 	bool Parse(); // parse preparsed script; return if successfull
 	void ParseDescs(); // parse function descs
@@ -515,8 +606,7 @@ public:
 
 public:
 	C4Value DirectExec(C4Object *pObj, const char *szScript, const char *szContext, bool fPassErrors = false, C4AulScriptStrict Strict = C4AulScriptStrict::MAXSTRICT); // directly parse uncompiled script (WARG! CYCLES!)
-	void ResetProfilerTimes(); // zero all profiler times of owned functions
-	void CollectProfilerTimes(class C4AulProfiler &rProfiler);
+	void CollectProfilerFuncs(class C4AulProfiler &rProfiler); // register owned functions for the profiler summary
 
 	bool IsReady() { return State == ASS_PARSED; } // whether script calls may be done
 
@@ -540,6 +630,7 @@ public:
 	int warnCnt, errCnt; // number of warnings/errors
 	int nonStrictCnt; // number of non-strict scripts
 	int lineCnt; // line count parsed
+	bool Superinstructions; // combine common byte code sequences when parsing; only disabled to measure their gain
 
 	C4ValueList Global;
 	C4ValueMapNames GlobalNamedNames;
@@ -23,9 +23,12 @@
 #include <C4Object.h>
 #include <C4Config.h>
 #include <C4Game.h>
+#include <C4Profiler.h>
 #include <C4ValueHash.h>
 #include <C4Wrappers.h>
 
+#include <chrono>
+
 C4AulExecError::C4AulExecError(C4Object *pObj, const char *szError) : cObj(pObj)
 {
 	// direct error message string
@@ -98,7 +101,7 @@ class C4AulExec
 {
 public:
 	C4AulExec()
-		: pCurCtx(Contexts - 1), pCurVal(Values - 1), iTraceStart(-1) {}
+		: pCurCtx(Contexts - 1), pCurVal(Values - 1), iTraceStart(-1), fProfiling(false), pProfiler(nullptr) {}
 
 private:
 	C4AulScriptContext Contexts[MAX_CONTEXT_STACK];
@@ -109,7 +112,7 @@ private:
 
 	int iTraceStart;
 	bool fProfiling;
-	time_t tDirectExecStart, tDirectExecTotal; // profiler time for DirectExec
+	C4AulProfiler *pProfiler; // collected data of the running profiler
 	C4AulScript *pProfiledScript;
 
 public:
@@ -119,11 +122,40 @@ public:
 	void StartTrace();
 	void StartProfiling(C4AulScript *pScript); // resets profling times and starts recording the times
 	void StopProfiling(); // stop the profiler and displays results
-	void AbortProfiling() { fProfiling = false; }
-	inline void StartDirectExec() { if (fProfiling) tDirectExecStart = timeGetTime(); }
-	inline void StopDirectExec() { if (fProfiling) tDirectExecTotal += timeGetTime() - tDirectExecStart; }
+	void AbortProfiling();
+	uint64_t GetExecutedChunks() const { return fProfiling ? pProfiler->GetChunkHits() : 0; }
 
 private:
+	static uint64_t GetProfilerTime()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	void StartProfilerContext(C4AulScriptContext *pCtx)
+	{
+		// descend the call tree along the call stack
+		C4AulProfilerNode *pParent = pCtx > Contexts ? pCtx[-1].pProfilerNode : pProfiler->GetRoot();
+		pCtx->pProfilerNode = pParent->GetChild(pCtx->Func ? pCtx->Func->GetProfilerName() : "(unknown)");
+		++pCtx->pProfilerNode->Calls;
+		pCtx->tCalleeTime = 0;
+		pCtx->tTime = GetProfilerTime();
+	}
+
+	void StopProfilerContext(C4AulScriptContext *pCtx)
+	{
+		const uint64_t dt = GetProfilerTime() - pCtx->tTime;
+		pCtx->pProfilerNode->InclusiveTime += dt;
+		pCtx->pProfilerNode->SelfTime += dt - std::min(dt, pCtx->tCalleeTime);
+		if (pCtx > Contexts) pCtx[-1].tCalleeTime += dt;
+	}
+
+	void ProfileChunk(C4AulBCC *pCPos)
+	{
+		// chunks of temporary scripts cannot be mapped to lines after the script is gone
+		if (fProfiling && !pCurCtx->Func->Owner->Temporary)
+			pProfiler->HitChunk(pCPos, pCurCtx->Func);
+	}
+
 	void PushContext(const C4AulScriptContext &rContext)
 	{
 		if (pCurCtx >= Contexts + MAX_CONTEXT_STACK - 1)
@@ -137,7 +169,8 @@ private:
 			pCurCtx->dump(std::move(Buf));
 		}
 		// Profiler: Safe time to measure difference afterwards
-		if (fProfiling) pCurCtx->tTime = timeGetTime();
+		if (fProfiling) StartProfilerContext(pCurCtx);
+		if (C4Profiler::IsEnabled()) C4Profiler::Begin(pCurCtx->Func ? pCurCtx->Func->GetProfilerName() : "(unknown)");
 	}
 
 	void PopContext()
@@ -145,12 +178,8 @@ private:
 		if (pCurCtx < Contexts)
 			throw new C4AulExecError(pCurCtx->Obj, "context stack underflow!");
 		// Profiler adding up times
-		if (fProfiling)
-		{
-			time_t dt = timeGetTime() - pCurCtx->tTime;
-			if (dt && pCurCtx->Func)
-				pCurCtx->Func->tProfileTime += dt;
-		}
+		if (fProfiling) StopProfilerContext(pCurCtx);
+		C4Profiler::End();
 		// Trace done?
 		if (iTraceStart >= 0)
 		{
@@ -348,8 +377,64 @@ C4Value C4AulExec::Exec(C4AulScriptFunc *pSFunc, C4Object *pObj, C4Value *pnPars
 	return Exec(pSFunc->Code, fPassErrors);
 }
 
+// Byte code dispatch: With GCC and Clang, every handler jumps directly to the handler of the next chunk
+// (computed goto), which gives each handler its own well-predictable indirect branch.
+// Other compilers loop over the switch.
+#if defined(__GNUC__) && !defined(C4AUL_NO_THREADED_DISPATCH)
+#define C4AUL_THREADED_DISPATCH
+#endif
+
+#ifdef C4AUL_THREADED_DISPATCH
+#define C4AUL_CASE(type) case type: Label_##type
+// the table is selected on every dispatch, so starting or stopping the profiler from script takes effect immediately
+#define C4AUL_DISPATCH() goto *DispatchTables[fProfiling][pCPos->bccType]
+#else
+#define C4AUL_CASE(type) case type
+#define C4AUL_DISPATCH() continue
+#endif
+
+#define C4AUL_NEXT() { ++pCPos; C4AUL_DISPATCH(); }
+#define C4AUL_JUMP(target) { pCPos = (target); C4AUL_DISPATCH(); }
+
 C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 {
+#ifdef C4AUL_THREADED_DISPATCH
+	// first table for normal execution, second one while profiling
+	static void *DispatchTables[2][AB_PARN_V_FUNC + 1];
+	auto &DispatchTable = DispatchTables[false], &ProfilingDispatchTable = DispatchTables[true];
+	if (!DispatchTable[AB_EOF])
+	{
+		for (auto &label : DispatchTable) label = &&Label_Default;
+		// the profiler counts every chunk at the loop head before dispatching it through the switch
+		for (auto &label : ProfilingDispatchTable) label = &&Label_Profile;
+#define C4AUL_LABEL(type) DispatchTable[type] = &&Label_##type
+		C4AUL_LABEL(AB_DEREF); C4AUL_LABEL(AB_MAPA_R); C4AUL_LABEL(AB_MAPA_V); C4AUL_LABEL(AB_ARRAYA_R); C4AUL_LABEL(AB_ARRAYA_V); C4AUL_LABEL(AB_ARRAY_APPEND);
+		C4AUL_LABEL(AB_VARN_R); C4AUL_LABEL(AB_VARN_V); C4AUL_LABEL(AB_PARN_R); C4AUL_LABEL(AB_PARN_V);
+		C4AUL_LABEL(AB_LOCALN_R); C4AUL_LABEL(AB_LOCALN_V); C4AUL_LABEL(AB_GLOBALN_R); C4AUL_LABEL(AB_GLOBALN_V);
+		C4AUL_LABEL(AB_VAR_R); C4AUL_LABEL(AB_VAR_V); C4AUL_LABEL(AB_PAR_R); C4AUL_LABEL(AB_PAR_V); C4AUL_LABEL(AB_FUNC);
+		C4AUL_LABEL(AB_Inc1); C4AUL_LABEL(AB_Dec1); C4AUL_LABEL(AB_BitNot); C4AUL_LABEL(AB_Not); C4AUL_LABEL(AB_Neg);
+		C4AUL_LABEL(AB_Inc1_Postfix); C4AUL_LABEL(AB_Dec1_Postfix);
+		C4AUL_LABEL(AB_Pow); C4AUL_LABEL(AB_Div); C4AUL_LABEL(AB_Mul); C4AUL_LABEL(AB_Mod); C4AUL_LABEL(AB_Sub); C4AUL_LABEL(AB_Sum);
+		C4AUL_LABEL(AB_LeftShift); C4AUL_LABEL(AB_RightShift);
+		C4AUL_LABEL(AB_LessThan); C4AUL_LABEL(AB_LessThanEqual); C4AUL_LABEL(AB_GreaterThan); C4AUL_LABEL(AB_GreaterThanEqual);
+		C4AUL_LABEL(AB_Concat); C4AUL_LABEL(AB_EqualIdent); C4AUL_LABEL(AB_Equal); C4AUL_LABEL(AB_NotEqualIdent); C4AUL_LABEL(AB_NotEqual);
+		C4AUL_LABEL(AB_SEqual); C4AUL_LABEL(AB_SNEqual); C4AUL_LABEL(AB_BitAnd); C4AUL_LABEL(AB_BitXOr); C4AUL_LABEL(AB_BitOr);
+		C4AUL_LABEL(AB_And); C4AUL_LABEL(AB_Or);
+		C4AUL_LABEL(AB_PowIt); C4AUL_LABEL(AB_MulIt); C4AUL_LABEL(AB_DivIt); C4AUL_LABEL(AB_ModIt); C4AUL_LABEL(AB_Inc); C4AUL_LABEL(AB_Dec);
+		C4AUL_LABEL(AB_LeftShiftIt); C4AUL_LABEL(AB_RightShiftIt); C4AUL_LABEL(AB_ConcatIt);
+		C4AUL_LABEL(AB_AndIt); C4AUL_LABEL(AB_OrIt); C4AUL_LABEL(AB_XOrIt); C4AUL_LABEL(AB_Set);
+		C4AUL_LABEL(AB_CALLGLOBAL); C4AUL_LABEL(AB_CALL); C4AUL_LABEL(AB_CALLFS); C4AUL_LABEL(AB_CALLNS); C4AUL_LABEL(AB_STACK);
+		C4AUL_LABEL(AB_NIL); C4AUL_LABEL(AB_INT); C4AUL_LABEL(AB_BOOL); C4AUL_LABEL(AB_STRING); C4AUL_LABEL(AB_C4ID);
+		C4AUL_LABEL(AB_ARRAY); C4AUL_LABEL(AB_MAP); C4AUL_LABEL(AB_IVARN);
+		C4AUL_LABEL(AB_JUMP); C4AUL_LABEL(AB_JUMPAND); C4AUL_LABEL(AB_JUMPOR); C4AUL_LABEL(AB_JUMPNIL); C4AUL_LABEL(AB_CONDN);
+		C4AUL_LABEL(AB_FOREACH_NEXT); C4AUL_LABEL(AB_FOREACH_MAP_NEXT); C4AUL_LABEL(AB_RETURN); C4AUL_LABEL(AB_ERR); C4AUL_LABEL(AB_EOFN);
+		C4AUL_LABEL(AB_VARN_V_INT_CMP_CONDN); C4AUL_LABEL(AB_VARN_R_INC1_STACK); C4AUL_LABEL(AB_PARN_V_FUNC);
+#undef C4AUL_LABEL
+		// AB_EOF is never executed, but marks the table as initialized
+		DispatchTable[AB_EOF] = &&Label_Default;
+	}
+#endif
+
 	// Save start context
 	C4AulScriptContext *pOldCtx = pCurCtx;
 
@@ -357,50 +442,54 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 	{
 		for (;;)
 		{
-			bool fJump = false;
+#ifdef C4AUL_THREADED_DISPATCH
+		Label_Profile:
+#endif
+			if (fProfiling) ProfileChunk(pCPos);
+
 			switch (pCPos->bccType)
 			{
-			case AB_NIL:
+			C4AUL_CASE(AB_NIL):
 				PushValue(C4VNull);
-				break;
+				C4AUL_NEXT();
 
-			case AB_INT:
+			C4AUL_CASE(AB_INT):
 				PushValue(C4VInt(pCPos->bccX));
-				break;
+				C4AUL_NEXT();
 
-			case AB_BOOL:
+			C4AUL_CASE(AB_BOOL):
 				PushValue(C4VBool(!!pCPos->bccX));
-				break;
+				C4AUL_NEXT();
 
-			case AB_STRING:
+			C4AUL_CASE(AB_STRING):
 				PushString(reinterpret_cast<C4String *>(pCPos->bccX));
-				break;
+				C4AUL_NEXT();
 
-			case AB_C4ID:
+			C4AUL_CASE(AB_C4ID):
 				PushValue(C4VID(pCPos->bccX));
-				break;
+				C4AUL_NEXT();
 
-			case AB_EOFN:
+			C4AUL_CASE(AB_EOFN):
 				throw new C4AulExecError(pCurCtx->Obj, "function didn't return");
 
-			case AB_ERR:
+			C4AUL_CASE(AB_ERR):
 				throw new C4AulExecError(pCurCtx->Obj, "syntax error: see previous parser error for details.");
 
-			case AB_PARN_R:
+			C4AUL_CASE(AB_PARN_R):
 				PushValueRef(pCurCtx->Pars[pCPos->bccX]);
-				break;
-			case AB_PARN_V:
+				C4AUL_NEXT();
+			C4AUL_CASE(AB_PARN_V):
 				PushValue(pCurCtx->Pars[pCPos->bccX]);
-				break;
+				C4AUL_NEXT();
 
-			case AB_VARN_R:
+			C4AUL_CASE(AB_VARN_R):
 				PushValueRef(pCurCtx->Vars[pCPos->bccX]);
-				break;
-			case AB_VARN_V:
+				C4AUL_NEXT();
+			C4AUL_CASE(AB_VARN_V):
 				PushValue(pCurCtx->Vars[pCPos->bccX]);
-				break;
+				C4AUL_NEXT();
 
-			case AB_LOCALN_R: case AB_LOCALN_V:
+			C4AUL_CASE(AB_LOCALN_R): C4AUL_CASE(AB_LOCALN_V):
 				if (!pCurCtx->Obj)
 					throw new C4AulExecError(pCurCtx->Obj, "can't access local variables in a definition call!");
 				if (pCurCtx->Func->Owner->Def != pCurCtx->Obj->Def)
@@ -423,66 +512,66 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 					PushValueRef(*pCurCtx->Obj->LocalNamed.GetItem(pCPos->bccX));
 				else
 					PushValue(*pCurCtx->Obj->LocalNamed.GetItem(pCPos->bccX));
-				break;
+				C4AUL_NEXT();
 
-			case AB_GLOBALN_R:
+			C4AUL_CASE(AB_GLOBALN_R):
 				PushValueRef(*Game.ScriptEngine.GlobalNamed.GetItem(pCPos->bccX));
-				break;
-			case AB_GLOBALN_V:
+				C4AUL_NEXT();
+			C4AUL_CASE(AB_GLOBALN_V):
 				PushValue(*Game.ScriptEngine.GlobalNamed.GetItem(pCPos->bccX));
-				break;
+				C4AUL_NEXT();
 			// prefix
-			case AB_Inc1: // ++
+			C4AUL_CASE(AB_Inc1): // ++
 				CheckOpPar<C4V_Int, false>(pCPos->bccX);
 				++pCurVal->GetData().Int;
 				pCurVal->HintType(C4V_Int);
-				break;
-			case AB_Dec1: // --
+				C4AUL_NEXT();
+			C4AUL_CASE(AB_Dec1): // --
 				CheckOpPar<C4V_Int, false>(pCPos->bccX);
 				--pCurVal->GetData().Int;
 				pCurVal->HintType(C4V_Int);
-				break;
-			case AB_BitNot: // ~
+				C4AUL_NEXT();
+			C4AUL_CASE(AB_BitNot): // ~
 				CheckOpPar<C4V_Any, false>(pCPos->bccX);
 				pCurVal->SetInt(~pCurVal->_getInt());
-				break;
-			case AB_Not: // !
+				C4AUL_NEXT();
+			C4AUL_CASE(AB_Not): // !
 				CheckOpPar(pCPos->bccX);
 				pCurVal->SetBool(!pCurVal->_getRaw());
-				break;
-			case AB_Neg: // -
+				C4AUL_NEXT();
+			C4AUL_CASE(AB_Neg): // -
 				CheckOpPar<C4V_Any, false>(pCPos->bccX);
 				pCurVal->SetInt(-pCurVal->_getInt());
-				break;
+				C4AUL_NEXT();
 			// postfix (whithout second statement)
-			case AB_Inc1_Postfix: // ++
+			C4AUL_CASE(AB_Inc1_Postfix): // ++
 			{
 				CheckOpPar<C4V_Int, false>(pCPos->bccX);
 				auto &orig = pCurVal->GetRefVal();
 				pCurVal->SetInt(orig._getInt());
 				++orig.GetData().Int;
 				orig.HintType(C4V_Int);
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_Dec1_Postfix: // --
+			C4AUL_CASE(AB_Dec1_Postfix): // --
 			{
 				CheckOpPar<C4V_Int, false>(pCPos->bccX);
 				auto &orig = pCurVal->GetRefVal();
 				pCurVal->SetInt(orig._getInt());
 				--orig.GetData().Int;
 				orig.HintType(C4V_Int);
-				break;
+				C4AUL_NEXT();
 			}
 			// postfix
-			case AB_Pow: // **
+			C4AUL_CASE(AB_Pow): // **
 			{
 				CheckOpPars<C4V_Any, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->SetInt(Pow(pPar1->_getInt(), pPar2->_getInt()));
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_Div: // /
+			C4AUL_CASE(AB_Div): // /
 			{
 				CheckOpPars<C4V_Any, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
@@ -491,17 +580,17 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 				else
 					pPar1->Set0();
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_Mul: // *
+			C4AUL_CASE(AB_Mul): // *
 			{
 				CheckOpPars<C4V_Any, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->SetInt(pPar1->_getInt() * pPar2->_getInt());
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_Mod: // %
+			C4AUL_CASE(AB_Mod): // %
 			{
 				CheckOpPars<C4V_Any, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
@@ -510,74 +599,74 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 				else
 					pPar1->Set0();
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_Sub: // -
+			C4AUL_CASE(AB_Sub): // -
 			{
 				CheckOpPars<C4V_Any, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->SetInt(pPar1->_getInt() - pPar2->_getInt());
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_Sum: // +
+			C4AUL_CASE(AB_Sum): // +
 			{
 				CheckOpPars<C4V_Any, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->SetInt(pPar1->_getInt() + pPar2->_getInt());
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_LeftShift: // <<
+			C4AUL_CASE(AB_LeftShift): // <<
 			{
 				CheckOpPars<C4V_Any, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->SetInt(pPar1->_getInt() << pPar2->_getInt());
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_RightShift: // >>
+			C4AUL_CASE(AB_RightShift): // >>
 			{
 				CheckOpPars<C4V_Any, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->SetInt(pPar1->_getInt() >> pPar2->_getInt());
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_LessThan: // <
+			C4AUL_CASE(AB_LessThan): // <
 			{
 				CheckOpPars<C4V_Any, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->SetBool(pPar1->_getInt() < pPar2->_getInt());
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_LessThanEqual: // <=
+			C4AUL_CASE(AB_LessThanEqual): // <=
 			{
 				CheckOpPars<C4V_Any, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->SetBool(pPar1->_getInt() <= pPar2->_getInt());
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_GreaterThan: // >
+			C4AUL_CASE(AB_GreaterThan): // >
 			{
 				CheckOpPars<C4V_Any, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->SetBool(pPar1->_getInt() > pPar2->_getInt());
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_GreaterThanEqual: // >=
+			C4AUL_CASE(AB_GreaterThanEqual): // >=
 			{
 				CheckOpPars<C4V_Any, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->SetBool(pPar1->_getInt() >= pPar2->_getInt());
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_Concat: // ..
-			case AB_ConcatIt: // ..=
+			C4AUL_CASE(AB_Concat): // ..
+			C4AUL_CASE(AB_ConcatIt): // ..=
 			{
 				const auto operatorName = C4ScriptOpMap[pCPos->bccX].Identifier;
 				CheckOpPars<C4V_Any, C4V_Any, false, false>(pCPos->bccX);
@@ -640,206 +729,206 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 							throw new C4AulExecError(pCurCtx->Obj, FormatString("operator \"%s\" left side: can not convert \"%s\" to \"string\", \"array\" or \"map\"!", operatorName, GetC4VName(type)).getData());
 						}
 				}
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_EqualIdent: // old ==
+			C4AUL_CASE(AB_EqualIdent): // old ==
 			{
 				CheckOpPars(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->SetBool(pPar1->Equals(*pPar2, C4AulScriptStrict::NONSTRICT));
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_Equal: // new ==
+			C4AUL_CASE(AB_Equal): // new ==
 			{
 				CheckOpPars(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->SetBool(pPar1->Equals(*pPar2, pCurCtx->Func->pOrgScript->Strict));
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_NotEqualIdent: // old !=
+			C4AUL_CASE(AB_NotEqualIdent): // old !=
 			{
 				CheckOpPars(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->SetBool(!pPar1->Equals(*pPar2, C4AulScriptStrict::NONSTRICT));
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_NotEqual: // new !=
+			C4AUL_CASE(AB_NotEqual): // new !=
 			{
 				CheckOpPars(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->SetBool(!pPar1->Equals(*pPar2, pCurCtx->Func->pOrgScript->Strict));
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_SEqual: // S=, eq
+			C4AUL_CASE(AB_SEqual): // S=, eq
 			{
 				CheckOpPars(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->SetBool(SEqual(pPar1->_getStr() ? pPar1->_getStr()->Data.getData() : "",
 					pPar2->_getStr() ? pPar2->_getStr()->Data.getData() : ""));
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_SNEqual: // ne
+			C4AUL_CASE(AB_SNEqual): // ne
 			{
 				CheckOpPars(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->SetBool(!SEqual(pPar1->_getStr() ? pPar1->_getStr()->Data.getData() : "",
 					pPar2->_getStr() ? pPar2->_getStr()->Data.getData() : ""));
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_BitAnd: // &
+			C4AUL_CASE(AB_BitAnd): // &
 			{
 				CheckOpPars<C4V_Any, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->SetInt(pPar1->_getInt() & pPar2->_getInt());
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_BitXOr: // ^
+			C4AUL_CASE(AB_BitXOr): // ^
 			{
 				CheckOpPars<C4V_Any, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->SetInt(pPar1->_getInt() ^ pPar2->_getInt());
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_BitOr: // |
+			C4AUL_CASE(AB_BitOr): // |
 			{
 				CheckOpPars<C4V_Any, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->SetInt(pPar1->_getInt() | pPar2->_getInt());
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_And: // &&
+			C4AUL_CASE(AB_And): // &&
 			{
 				CheckOpPars(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->SetBool(pPar1->_getRaw() && pPar2->_getRaw());
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_Or: // ||
+			C4AUL_CASE(AB_Or): // ||
 			{
 				CheckOpPars(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->SetBool(pPar1->_getRaw() || pPar2->_getRaw());
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_PowIt: // **=
+			C4AUL_CASE(AB_PowIt): // **=
 			{
 				CheckOpPars<C4V_Int, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->GetData().Int = Pow(pPar1->GetData().Int, pPar2->_getInt());
 				pPar1->HintType(C4V_Int);
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_MulIt: // *=
+			C4AUL_CASE(AB_MulIt): // *=
 			{
 				CheckOpPars<C4V_Int, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->GetData().Int *= pPar2->_getInt();
 				pCurVal->HintType(C4V_Int);
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_DivIt: // /=
+			C4AUL_CASE(AB_DivIt): // /=
 			{
 				CheckOpPars<C4V_Int, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->GetData().Int = pPar2->_getInt() ? pPar1->GetData().Int / pPar2->_getInt() : 0;
 				pPar1->HintType(C4V_Int);
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_ModIt: // %=
+			C4AUL_CASE(AB_ModIt): // %=
 			{
 				CheckOpPars<C4V_Int, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->GetData().Int = pPar2->_getInt() ? pPar1->GetData().Int % pPar2->_getInt() : 0;
 				pPar1->HintType(C4V_Int);
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_Inc: // +=
+			C4AUL_CASE(AB_Inc): // +=
 			{
 				CheckOpPars<C4V_Int, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->GetData().Int += pPar2->_getInt();
 				pPar1->HintType(C4V_Int);
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_Dec: // -=
+			C4AUL_CASE(AB_Dec): // -=
 			{
 				CheckOpPars<C4V_Int, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->GetData().Int -= pPar2->_getInt();
 				pPar1->HintType(C4V_Int);
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_LeftShiftIt: // <<=
+			C4AUL_CASE(AB_LeftShiftIt): // <<=
 			{
 				CheckOpPars<C4V_Int, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->GetData().Int <<= pPar2->_getInt();
 				pPar1->HintType(C4V_Int);
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_RightShiftIt: // >>=
+			C4AUL_CASE(AB_RightShiftIt): // >>=
 			{
 				CheckOpPars<C4V_Int, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->GetData().Int >>= pPar2->_getInt();
 				pPar1->HintType(C4V_Int);
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_AndIt: // &=
+			C4AUL_CASE(AB_AndIt): // &=
 			{
 				CheckOpPars<C4V_Int, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->GetData().Int &= pPar2->_getInt();
 				pPar1->HintType(C4V_Int);
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_OrIt: // |=
+			C4AUL_CASE(AB_OrIt): // |=
 			{
 				CheckOpPars<C4V_Int, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->GetData().Int |= pPar2->_getInt();
 				pPar1->HintType(C4V_Int);
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_XOrIt: // ^=
+			C4AUL_CASE(AB_XOrIt): // ^=
 			{
 				CheckOpPars<C4V_Int, C4V_Any, false, false>(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				pPar1->GetData().Int ^= pPar2->_getInt();
 				pPar1->HintType(C4V_Int);
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_Set: // =
+			C4AUL_CASE(AB_Set): // =
 			{
 				CheckOpPars(pCPos->bccX);
 				C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
 				*pPar1 = *pPar2;
 				PopValue();
-				break;
+				C4AUL_NEXT();
 			}
-			case AB_ARRAY:
+			C4AUL_CASE(AB_ARRAY):
 			{
 				// Create array
 				C4ValueArray *pArray = new C4ValueArray(pCPos->bccX);
@@ -857,10 +946,10 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 				else
 					PushArray(pArray);
 
-				break;
+				C4AUL_NEXT();
 			}
 
-			case AB_MAP:
+			C4AUL_CASE(AB_MAP):
 			{
 				C4ValueHash *map = new C4ValueHash;
 				for (int i = 0; i < pCPos->bccX; ++i)
@@ -876,10 +965,10 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 				else
 					PushMap(map);
 
-				break;
+				C4AUL_NEXT();
 			}
 
-			case AB_ARRAYA_R: case AB_ARRAYA_V:
+			C4AUL_CASE(AB_ARRAYA_R): C4AUL_CASE(AB_ARRAYA_V):
 			{
 				C4Value &Container = pCurVal[-1].GetRefVal();
 				C4Value &Index = pCurVal[0];
@@ -893,7 +982,7 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 					Container.GetContainerElement(&Index, pCurVal[-1], pCurCtx, pCPos->bccType == AB_ARRAYA_V);
 					// Remove index
 					PopValue();
-					break;
+					C4AUL_NEXT();
 				}
 
 
@@ -920,13 +1009,13 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 						pCurVal[-1].SetString(new C4String(std::move(result), &pCurCtx->Func->Owner->GetEngine()->Strings));
 					}
 					PopValue();
-					break;
+					C4AUL_NEXT();
 				}
 				else
 					throw new C4AulExecError(pCurCtx->Obj, FormatString("indexed access: can't access %s by index!", Container.GetTypeName()).getData());
 			}
 
-			case AB_MAPA_R: case AB_MAPA_V:
+			C4AUL_CASE(AB_MAPA_R): C4AUL_CASE(AB_MAPA_V):
 			{
 				C4Value &Map = pCurVal->GetRefVal();
 				if (Map.GetType() == C4V_Any)
@@ -942,10 +1031,10 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 				C4Value key(reinterpret_cast<C4String *>(pCPos->bccX));
 				Map.GetContainerElement(&key, *pCurVal, pCurCtx, pCPos->bccType == AB_MAPA_V);
 
-				break;
+				C4AUL_NEXT();
 			}
 
-			case AB_ARRAY_APPEND:
+			C4AUL_CASE(AB_ARRAY_APPEND):
 			{
 				C4Value &Array = pCurVal[0].GetRefVal();
 				// Typcheck
@@ -955,67 +1044,62 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 				C4Value index = C4VInt(Array._getArray()->GetSize());
 				Array.GetContainerElement(&index, pCurVal[0], pCurCtx);
 
-				break;
+				C4AUL_NEXT();
 			}
 
-			case AB_DEREF:
+			C4AUL_CASE(AB_DEREF):
 				pCurVal[0].Deref();
 
-			case AB_STACK:
+			C4AUL_CASE(AB_STACK):
 				if (pCPos->bccX < 0)
 					PopValues(-pCPos->bccX);
 				else
 					PushNullVals(pCPos->bccX);
-				break;
+				C4AUL_NEXT();
 
-			case AB_JUMP:
-				fJump = true;
-				pCPos += pCPos->bccX;
-				break;
+			C4AUL_CASE(AB_JUMP):
+				C4AUL_JUMP(pCPos + pCPos->bccX);
 
-			case AB_JUMPAND:
+			C4AUL_CASE(AB_JUMPAND):
 				if (!pCurVal[0])
 				{
-					fJump = true;
-					pCPos += pCPos->bccX;
+					C4AUL_JUMP(pCPos + pCPos->bccX);
 				}
 				else
 				{
 					PopValue();
 				}
-				break;
+				C4AUL_NEXT();
 
-			case AB_JUMPOR:
+			C4AUL_CASE(AB_JUMPOR):
 				if (!!pCurVal[0])
 				{
-					fJump = true;
-					pCPos += pCPos->bccX;
+					C4AUL_JUMP(pCPos + pCPos->bccX);
 				}
 				else
 				{
 					PopValue();
 				}
-				break;
+				C4AUL_NEXT();
 
-			case AB_JUMPNIL:
+			C4AUL_CASE(AB_JUMPNIL):
 				if (pCurVal[0].GetType() == C4V_Any)
 				{
 					pCurVal[0].Deref();
-					fJump = true;
-					pCPos += pCPos->bccX;
+					C4AUL_JUMP(pCPos + pCPos->bccX);
 				}
-				break;
+				C4AUL_NEXT();
 
-			case AB_CONDN:
+			C4AUL_CASE(AB_CONDN):
 				if (!pCurVal[0])
 				{
-					fJump = true;
-					pCPos += pCPos->bccX;
+					PopValue();
+					C4AUL_JUMP(pCPos + pCPos->bccX);
 				}
 				PopValue();
-				break;
+				C4AUL_NEXT();
 
-			case AB_RETURN:
+			C4AUL_CASE(AB_RETURN):
 			{
 				// Resolve reference
 				if (!pCurCtx->Func->SFunc()->bReturnRef)
@@ -1051,13 +1135,15 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 				PopValuesUntil(pReturn);
 
 				// Jump back, continue.
-				pCPos = pCurCtx->CPos + 1;
-				fJump = true;
-
-				break;
+				C4AUL_JUMP(pCurCtx->CPos + 1);
 			}
 
-			case AB_FUNC:
+			C4AUL_CASE(AB_PARN_V_FUNC):
+				PushValue(pCurCtx->Pars[pCPos->bccX]);
+				++pCPos;
+				[[fallthrough]];
+
+			C4AUL_CASE(AB_FUNC):
 			{
 				// Get function call data
 				C4AulFunc *pFunc = reinterpret_cast<C4AulFunc *>(pCPos->bccX);
@@ -1073,13 +1159,12 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 				C4AulBCC *pJump = Call(pFunc, pPars, pPars, nullptr);
 				if (pJump)
 				{
-					pCPos = pJump;
-					fJump = true;
+					C4AUL_JUMP(pJump);
 				}
-				break;
+				C4AUL_NEXT();
 			}
 
-			case AB_VAR_R: case AB_VAR_V:
+			C4AUL_CASE(AB_VAR_R): C4AUL_CASE(AB_VAR_V):
 				if (!pCurVal->ConvertTo(C4V_Int))
 					throw new C4AulExecError(pCurCtx->Obj, FormatString("Var: index of type %s, int expected!", pCurVal->GetTypeName()).getData());
 				// Push reference to variable on the stack
@@ -1087,9 +1172,9 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 					pCurVal->SetRef(&pCurCtx->NumVars.GetItem(pCurVal->_getInt()));
 				else
 					pCurVal->Set(pCurCtx->NumVars.GetItem(pCurVal->_getInt()));
-				break;
+				C4AUL_NEXT();
 
-			case AB_PAR_R: case AB_PAR_V:
+			C4AUL_CASE(AB_PAR_R): C4AUL_CASE(AB_PAR_V):
 				if (!pCurVal->ConvertTo(C4V_Int))
 					throw new C4AulExecError(pCurCtx->Obj, FormatString("Par: index of type %s, int expected!", pCurVal->GetTypeName()).getData());
 				// Push reference to parameter on the stack
@@ -1102,9 +1187,9 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 				}
 				else
 					pCurVal->Set0();
-				break;
+				C4AUL_NEXT();
 
-			case AB_FOREACH_NEXT:
+			C4AUL_CASE(AB_FOREACH_NEXT):
 			{
 				// This should always hold
 				assert(pCurVal->ConvertTo(C4V_Int));
@@ -1120,18 +1205,18 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 				C4ValueArray *pArray = pCurVal[-1]._getArray();
 				// No more entries?
 				if (pCurVal->_getInt() >= pArray->GetSize())
-					break;
+				{
+					C4AUL_NEXT();
+				}
 				// Get next
 				pCurCtx->Vars[pCPos->bccX] = pArray->GetItem(iItem);
 				// Save position
 				pCurVal->SetInt(iItem + 1);
 				// Jump over next instruction
-				pCPos += 2;
-				fJump = true;
-				break;
+				C4AUL_JUMP(pCPos + 2);
 			}
 
-			case AB_FOREACH_MAP_NEXT:
+			C4AUL_CASE(AB_FOREACH_MAP_NEXT):
 			{
 				// This should always hold
 				assert(pCurVal[-1].ConvertTo(C4V_Int));
@@ -1156,7 +1241,7 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 				if (*iterator == map->end())
 				{
 					delete iterator;
-					break;
+					C4AUL_NEXT();
 				}
 				// Get next
 				pCurCtx->Vars[pCPos->bccX] = (**iterator).first;
@@ -1164,23 +1249,21 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 
 				++(*iterator);
 				// Jump over next instruction
-				pCPos += 2;
-				fJump = true;
-				break;
+				C4AUL_JUMP(pCPos + 2);
 			}
 
-			case AB_IVARN:
+			C4AUL_CASE(AB_IVARN):
 				pCurCtx->Vars[pCPos->bccX] = pCurVal[0];
 				PopValue();
-				break;
+				C4AUL_NEXT();
 
-			case AB_CALLNS:
+			C4AUL_CASE(AB_CALLNS):
 				// Ignore. TODO: Fix this.
-				break;
+				C4AUL_NEXT();
 
-			case AB_CALL:
-			case AB_CALLFS:
-			case AB_CALLGLOBAL:
+			C4AUL_CASE(AB_CALL):
+			C4AUL_CASE(AB_CALLFS):
+			C4AUL_CASE(AB_CALLGLOBAL):
 			{
 				const auto isGlobal = pCPos->bccType == AB_CALLGLOBAL;
 				C4Value *pPars = pCurVal - C4AUL_MAX_Par + 1;
@@ -1215,27 +1298,40 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 							FormatString("Object call: Invalid target type %s, expected object or id!", pTargetVal->GetTypeName()).getData());
 				}
 
-				// Resolve overloads
-				C4AulFunc *pFunc = reinterpret_cast<C4AulFunc *>(pCPos->bccX);
-				while (pFunc->OverloadedBy)
-					pFunc = pFunc->OverloadedBy;
-
+				// Object calls: look up the function resolved for this definition at this call site before
+				C4AulCallCache *pCache = nullptr;
+				C4AulFunc *pFunc;
+				bool fCached = false;
 				if (!isGlobal)
 				{
+					pCache = reinterpret_cast<C4AulCallCache *>(pCPos->bccX);
+					fCached = pCache->Lookup(pDestDef, pFunc);
+				}
+
+				if (!fCached)
+				{
+					// Resolve overloads
+					pFunc = isGlobal ? reinterpret_cast<C4AulFunc *>(pCPos->bccX) : pCache->Func;
+					while (pFunc->OverloadedBy)
+						pFunc = pFunc->OverloadedBy;
+
 					// Search function for given context
-					pFunc = pFunc->FindSameNameFunc(pDestDef);
-					if (!pFunc && pCPos->bccType == AB_CALLFS)
-					{
-						PopValuesUntil(pTargetVal);
-						pTargetVal->Set0();
-						break;
-					}
+					if (!isGlobal)
+						pFunc = pFunc->FindSameNameFunc(pDestDef);
+				}
+
+				if (!pFunc && pCPos->bccType == AB_CALLFS)
+				{
+					if (!fCached) pCache->Store(pDestDef, nullptr);
+					PopValuesUntil(pTargetVal);
+					pTargetVal->Set0();
+					C4AUL_NEXT();
 				}
 
 				// Function not found?
 				if (!pFunc)
 				{
-					const char *szFuncName = reinterpret_cast<C4AulFunc *>(pCPos->bccX)->Name;
+					const char *szFuncName = (isGlobal ? reinterpret_cast<C4AulFunc *>(pCPos->bccX) : pCache->Func)->Name;
 					if (pDestObj)
 						throw new C4AulExecError(pCurCtx->Obj,
 							FormatString("Object call: No function \"%s\" in object \"%s\"!", szFuncName, pTargetVal->GetDataString().getData()).getData());
@@ -1244,7 +1340,8 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 							FormatString("Definition call: No function \"%s\" in definition \"%s\"!", szFuncName, pDestDef->Name.getData()).getData());
 				}
 
-				else if (C4AulScriptFunc *sfunc = pFunc->SFunc(); sfunc)
+				// Check access (cached functions have been checked when they were stored)
+				else if (C4AulScriptFunc *sfunc = pFunc->SFunc(); sfunc && !fCached)
 				{
 					C4AulScript *script = sfunc->pOrgScript;
 					if (sfunc->Access < script->GetAllowedAccess(pFunc, sfunc->pOrgScript))
@@ -1254,7 +1351,10 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 				}
 
 				// Save function back (optimization)
-				pCPos->bccX = reinterpret_cast<long>(pFunc);
+				if (isGlobal)
+					pCPos->bccX = reinterpret_cast<intptr_t>(pFunc);
+				else if (!fCached)
+					pCache->Store(pDestDef, pFunc);
 
 				// Save current position
 				pCurCtx->CPos = pCPos;
@@ -1264,20 +1364,57 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos, bool fPassErrors)
 				if (pNewCPos)
 				{
 					// Jump
-					pCPos = pNewCPos;
-					fJump = true;
+					C4AUL_JUMP(pNewCPos);
+				}
+
+				C4AUL_NEXT();
+			}
+
+			C4AUL_CASE(AB_VARN_V_INT_CMP_CONDN):
+			{
+				const C4Value &Var = pCurCtx->Vars[pCPos->bccX].GetRefVal();
+				// anything but int needs the conversions of the original sequence
+				if (Var.GetType() != C4V_Int)
+				{
+					PushValue(pCurCtx->Vars[pCPos->bccX]);
+					C4AUL_NEXT();
+				}
+				const int32_t iLeft = Var._getInt(), iRight = static_cast<int32_t>(pCPos[1].bccX);
+				bool fCondition;
+				switch (pCPos[2].bccType)
+				{
+				case AB_LessThan: fCondition = iLeft < iRight; break;
+				case AB_LessThanEqual: fCondition = iLeft <= iRight; break;
+				case AB_GreaterThan: fCondition = iLeft > iRight; break;
+				case AB_GreaterThanEqual: fCondition = iLeft >= iRight; break;
+				default: assert(false); fCondition = false;
+				}
+				if (!fCondition)
+				{
+					C4AUL_JUMP(pCPos + 3 + pCPos[3].bccX);
 				}
+				C4AUL_JUMP(pCPos + 4);
+			}
 
-				break;
+			C4AUL_CASE(AB_VARN_R_INC1_STACK):
+			{
+				C4Value &Var = pCurCtx->Vars[pCPos->bccX].GetRefVal();
+				if (Var.GetType() != C4V_Int)
+				{
+					PushValueRef(pCurCtx->Vars[pCPos->bccX]);
+					C4AUL_NEXT();
+				}
+				++Var.GetData().Int;
+				C4AUL_JUMP(pCPos + 3);
 			}
 
 			default:
+#ifdef C4AUL_THREADED_DISPATCH
+			Label_Default:
+#endif
 				assert(false);
+				C4AUL_NEXT();
 			}
-
-			// Continue
-			if (!fJump)
-				pCPos++;
 		}
 	}
 	catch (C4AulError *e)
@@ -1460,24 +1597,28 @@ void C4AulExec::StartProfiling(C4AulScript *pProfiledScript)
 	fProfiling = true;
 	// resets profling times and starts recording the times
 	this->pProfiledScript = pProfiledScript;
-	time_t tNow = timeGetTime();
-	tDirectExecStart = tNow; // in case profiling is started from DirectExec
-	tDirectExecTotal = 0;
-	pProfiledScript->ResetProfilerTimes();
+	pProfiler = new C4AulProfiler();
 	for (C4AulScriptContext *pCtx = Contexts; pCtx <= pCurCtx; ++pCtx)
-		pCtx->tTime = tNow;
+		StartProfilerContext(pCtx);
 }
 
 void C4AulExec::StopProfiling()
 {
 	// stop the profiler and displays results
 	if (!fProfiling) return;
+	// account for functions that are still running
+	for (C4AulScriptContext *pCtx = pCurCtx; pCtx >= Contexts; --pCtx)
+		StopProfilerContext(pCtx);
+	fProfiling = false;
+	pProfiledScript->CollectProfilerFuncs(*pProfiler);
+	pProfiler->Show();
+	delete pProfiler; pProfiler = nullptr;
+}
+
+void C4AulExec::AbortProfiling()
+{
 	fProfiling = false;
-	// collect profiler times
-	C4AulProfiler Profiler;
-	Profiler.CollectEntry(nullptr, tDirectExecTotal);
-	pProfiledScript->CollectProfilerTimes(Profiler);
-	Profiler.Show();
+	delete pProfiler; pProfiler = nullptr;
 }
 
 void C4AulProfiler::StartProfiling(C4AulScript *pScript)
@@ -1490,37 +1631,160 @@ void C4AulProfiler::StopProfiling()
 	AulExec.StopProfiling();
 }
 
+uint64_t C4AulProfiler::GetExecutedChunks()
+{
+	return AulExec.GetExecutedChunks();
+}
+
 void C4AulProfiler::Abort()
 {
 	AulExec.AbortProfiling();
 }
 
-void C4AulProfiler::CollectEntry(C4AulScriptFunc *pFunc, time_t tProfileTime)
+C4AulProfilerNode *C4AulProfilerNode::GetChild(const char *szName)
+{
+	// few distinct callees per caller: linear search
+	for (const auto &pChild : Children)
+		if (pChild->Name == szName)
+			return pChild.get();
+	Children.push_back(std::make_unique<C4AulProfilerNode>(szName, this));
+	return Children.back().get();
+}
+
+void C4AulProfiler::CollectFunc(C4AulScriptFunc *pFunc)
+{
+	ProfiledFuncs.insert(pFunc->GetProfilerName());
+}
+
+void C4AulProfiler::HitChunk(const C4AulBCC *pCPos, C4AulScriptFunc *pFunc)
+{
+	LineHits &Hits = ChunkHits[pCPos];
+	if (!Hits.Script)
+	{
+		// map the chunk to its script line on the first hit
+		Hits.Script = C4Profiler::InternName(pFunc->pOrgScript->ScriptName.getData());
+		Hits.Line = SGetLine(pFunc->pOrgScript->GetScript(), pCPos->SPos);
+	}
+	++Hits.Hits;
+}
+
+uint64_t C4AulProfiler::GetChunkHits() const
+{
+	uint64_t iHits = 0;
+	for (const auto &Chunk : ChunkHits) iHits += Chunk.second.Hits;
+	return iHits;
+}
+
+void C4AulProfiler::CollectEntries(C4AulProfilerNode *pNode, std::vector<const char *> &Stack, std::unordered_map<const char *, Entry> &Entries)
+{
+	Entry &e = Entries[pNode->Name];
+	e.Name = pNode->Name;
+	e.Calls += pNode->Calls;
+	e.SelfTime += pNode->SelfTime;
+	// the time of recursive calls is already contained in the outermost call
+	if (std::find(Stack.begin(), Stack.end(), pNode->Name) == Stack.end())
+		e.InclusiveTime += pNode->InclusiveTime;
+	Stack.push_back(pNode->Name);
+	for (const auto &pChild : pNode->Children)
+		CollectEntries(pChild.get(), Stack, Entries);
+	Stack.pop_back();
+}
+
+void C4AulProfiler::WriteStacks(FILE *pFile, C4AulProfilerNode *pNode, StdStrBuf &Stack)
 {
-	// zero entries are not collected to have a cleaner list
-	if (!tProfileTime) return;
-	// add entry to list
-	Entry e;
-	e.pFunc = pFunc;
-	e.tProfileTime = tProfileTime;
-	Times.push_back(e);
+	// collapsed stack format for flame graphs: function names separated by semicolons, followed by the self time in microseconds
+	const size_t iLength = Stack.getLength();
+	if (iLength) Stack.AppendChar(';');
+	Stack.Append(pNode->Name);
+	if (pNode->SelfTime >= 1000)
+		fprintf(pFile, "%s %llu\n", Stack.getData(), static_cast<unsigned long long>(pNode->SelfTime / 1000));
+	for (const auto &pChild : pNode->Children)
+		WriteStacks(pFile, pChild.get(), Stack);
+	Stack.SetLength(iLength);
+}
+
+bool C4AulProfiler::WriteReport(const char *szFilename, std::vector<Entry> &Entries)
+{
+	FILE *pFile = fopen(szFilename, "wb");
+	if (!pFile) return false;
+	fputs("Script profile (times in ms; inclusive times of recursive calls are counted once)\n", pFile);
+	// functions of all scripts
+	fputs("\nFunctions:\n  incl. ms    self ms      calls  function\n", pFile);
+	for (const Entry &e : Entries)
+		fprintf(pFile, "%10.3f %10.3f %10llu  %s\n", e.InclusiveTime / 1e6, e.SelfTime / 1e6, static_cast<unsigned long long>(e.Calls), e.Name);
+	// caller -> callee edges, merged over all call stacks
+	std::map<std::pair<const char *, const char *>, Entry> Edges;
+	std::vector<C4AulProfilerNode *> Nodes{&Root};
+	while (!Nodes.empty())
+	{
+		C4AulProfilerNode *pNode = Nodes.back(); Nodes.pop_back();
+		for (const auto &pChild : pNode->Children)
+		{
+			Entry &e = Edges[std::make_pair(pNode->Name, pChild->Name)];
+			e.Calls += pChild->Calls;
+			e.InclusiveTime += pChild->InclusiveTime;
+			e.SelfTime += pChild->SelfTime;
+			Nodes.push_back(pChild.get());
+		}
+	}
+	std::vector<std::pair<std::pair<const char *, const char *>, Entry>> EdgeList(Edges.begin(), Edges.end());
+	std::stable_sort(EdgeList.begin(), EdgeList.end(), [](const auto &a, const auto &b) { return b.second < a.second; });
+	fputs("\nCall graph:\n  incl. ms    self ms      calls  caller -> callee\n", pFile);
+	for (const auto &Edge : EdgeList)
+		fprintf(pFile, "%10.3f %10.3f %10llu  %s -> %s\n", Edge.second.InclusiveTime / 1e6, Edge.second.SelfTime / 1e6,
+			static_cast<unsigned long long>(Edge.second.Calls), Edge.first.first, Edge.first.second);
+	// executed chunks per script line
+	std::map<std::pair<const char *, int32_t>, uint64_t> Lines;
+	for (const auto &Chunk : ChunkHits)
+		Lines[std::make_pair(Chunk.second.Script, Chunk.second.Line)] += Chunk.second.Hits;
+	std::vector<std::pair<std::pair<const char *, int32_t>, uint64_t>> LineList(Lines.begin(), Lines.end());
+	std::stable_sort(LineList.begin(), LineList.end(), [](const auto &a, const auto &b) { return a.second > b.second; });
+	fputs("\nLines:\n      hits  script:line\n", pFile);
+	for (const auto &Line : LineList)
+		fprintf(pFile, "%10llu  %s:%d\n", static_cast<unsigned long long>(Line.second), Line.first.first, static_cast<int>(Line.first.second));
+	return !fclose(pFile);
 }
 
 void C4AulProfiler::Show()
 {
+	// sum up the call tree per function
+	std::unordered_map<const char *, Entry> EntryMap;
+	std::vector<const char *> Stack;
+	for (const auto &pChild : Root.Children)
+		CollectEntries(pChild.get(), Stack, EntryMap);
+	std::vector<Entry> Entries;
+	for (const auto &it : EntryMap) Entries.push_back(it.second);
 	// sort by time
-	std::sort(Times.rbegin(), Times.rend());
-	// display them
+	std::sort(Entries.rbegin(), Entries.rend());
+	// display the functions of the profiled script
+	const char *szDirectExec = C4Profiler::InternName(C4AUL_DirectExecName);
 	Log("Profiler statistics:");
 	Log("==============================");
-	typedef std::vector<Entry> EntryList;
-	for (EntryList::iterator i = Times.begin(); i != Times.end(); ++i)
+	Log("  incl. ms    self ms      calls  function");
+	for (const Entry &e : Entries)
+		if (ProfiledFuncs.count(e.Name) || e.Name == szDirectExec)
+			LogF("%10.3f %10.3f %10llu  %s", e.InclusiveTime / 1e6, e.SelfTime / 1e6, static_cast<unsigned long long>(e.Calls), e.Name);
+	Log("==============================");
+	// details of all scripts go to files
+	StdStrBuf Filename(Config.AtUserPath(C4CFN_ScriptProfile), true);
+	if (WriteReport(Filename.getData(), Entries))
+		LogF("Script profile written to %s", Filename.getData());
+	else
+		LogF("Could not write script profile to %s", Filename.getData());
+	Filename.Copy(Config.AtUserPath(C4CFN_ScriptProfileStacks));
+	FILE *pFile = fopen(Filename.getData(), "wb");
+	if (pFile)
 	{
-		Entry &e = (*i);
-		LogF("%05dms\t%s", (int)e.tProfileTime, e.pFunc ? (e.pFunc->GetFullName().getData()) : "Direct exec");
+		StdStrBuf StackBuf;
+		for (const auto &pChild : Root.Children)
+			WriteStacks(pFile, pChild.get(), StackBuf);
+		if (!fclose(pFile))
+		{
+			LogF("Script profile stacks written to %s", Filename.getData());
+			return;
+		}
 	}
-	Log("==============================");
-	// done!
+	LogF("Could not write script profile stacks to %s", Filename.getData());
 }
 
 C4Value C4AulFunc::Exec(C4Object *pObj, C4AulParSet *pPars, bool fPassErrors)
@@ -1590,8 +1854,6 @@ C4Value C4AulScript::DirectExec(C4Object *pObj, const char *szScript, const char
 	int32_t iObjNumber = pObj ? pObj->Number : -1;
 	AddDbgRec(RCT_DirectExec, &iObjNumber, sizeof(int32_t));
 #endif
-	// profiler
-	AulExec.StartDirectExec();
 	// Create a new temporary script as child of this script
 	C4AulScript *pScript = new C4AulScript();
 	pScript->Script.Copy(szScript);
@@ -1629,32 +1891,17 @@ C4Value C4AulScript::DirectExec(C4Object *pObj, const char *szScript, const char
 	pFunc->Code = pScript->Code;
 	pScript->State = ASS_PARSED;
 	// Execute. The TemporaryScript-parameter makes sure the script will be deleted later on.
-	C4Value vRetVal(AulExec.Exec(pFunc, pObj, nullptr, fPassErrors, true));
-	// profiler
-	AulExec.StopDirectExec();
-	return vRetVal;
-}
-
-void C4AulScript::ResetProfilerTimes()
-{
-	// zero all profiler times of owned functions
-	C4AulScriptFunc *pSFunc;
-	for (C4AulFunc *pFn = Func0; pFn; pFn = pFn->Next)
-		if (pSFunc = pFn->SFunc())
-			pSFunc->tProfileTime = 0;
-	// reset sub-scripts
-	for (C4AulScript *pScript = Child0; pScript; pScript = pScript->Next)
-		pScript->ResetProfilerTimes();
+	return AulExec.Exec(pFunc, pObj, nullptr, fPassErrors, true);
 }
 
-void C4AulScript::CollectProfilerTimes(class C4AulProfiler &rProfiler)
+void C4AulScript::CollectProfilerFuncs(C4AulProfiler &rProfiler)
 {
-	// collect all profiler times of owned functions
+	// register owned functions
 	C4AulScriptFunc *pSFunc;
 	for (C4AulFunc *pFn = Func0; pFn; pFn = pFn->Next)
 		if (pSFunc = pFn->SFunc())
-			rProfiler.CollectEntry(pSFunc, pSFunc->tProfileTime);
-	// collect sub-scripts
+			rProfiler.CollectFunc(pSFunc);
+	// register sub-scripts
 	for (C4AulScript *pScript = Child0; pScript; pScript = pScript->Next)
-		pScript->CollectProfilerTimes(rProfiler);
+		pScript->CollectProfilerFuncs(rProfiler);
 }
@@ -167,7 +167,7 @@ void C4AulScript::UnLink()
 	if (Temporary) return;
 
 	// check if byte code needs to be freed
-	delete[] Code; Code = nullptr;
+	ClearCode();
 
 	// delete included/appended functions
 	C4AulFunc *pFunc = Func0;
@@ -903,6 +903,11 @@ static const char *GetTTName(C4AulBCCType e)
 	case AB_EOFN:             return "AB_EOFN";             // end of function
 	case AB_EOF:              return "AB_EOF";
 
+	// superinstructions
+	case AB_VARN_V_INT_CMP_CONDN: return "AB_VARN_V_INT_CMP_CONDN";
+	case AB_VARN_R_INC1_STACK:    return "AB_VARN_R_INC1_STACK";
+	case AB_PARN_V_FUNC:          return "AB_PARN_V_FUNC";
+
 	default: return "?";
 	}
 }
@@ -3204,7 +3209,11 @@ bool C4AulParseState::Parse_Expression3()
 			Parse_Params(C4AUL_MAX_Par, pFunc ? pFunc->Name : 0, pFunc);
 			if (idNS != 0)
 				AddBCC(AB_CALLNS, (long)idNS);
-			AddBCC(eCallType, (long)pFunc);
+			// object calls get an inline cache for the resolved functions
+			if (eCallType != AB_CALLGLOBAL && Type == PARSER)
+				AddBCC(eCallType, reinterpret_cast<intptr_t>(a->AddCallCache(pFunc)));
+			else
+				AddBCC(eCallType, reinterpret_cast<intptr_t>(pFunc));
 			break;
 		}
 		default:
@@ -3488,10 +3497,7 @@ bool C4AulScript::Parse()
 	// don't parse global funcs again, as they're parsed already through links
 	if (this == Engine) return false;
 	// delete existing code
-	delete[] Code;
-	CodeSize = CodeBufSize = 0;
-	// reset code and script pos
-	CPos = Code;
+	ClearCode();
 
 	// parse script funcs
 	C4AulFunc *f;
@@ -3547,6 +3553,9 @@ bool C4AulScript::Parse()
 	// add eof chunk
 	AddBCC(AB_EOF);
 
+	// combine common sequences
+	CombineInstructions();
+
 	// calc absolute code addresses for script funcs
 	for (f = Func0; f; f = f->Next)
 	{
@@ -3581,8 +3590,10 @@ bool C4AulScript::Parse()
 					C4AulBCCType eType = pBCC->bccType; long X = pBCC->bccX;
 					switch (eType)
 					{
-					case AB_FUNC: case AB_CALL: case AB_CALLFS: case AB_CALLGLOBAL:
+					case AB_FUNC: case AB_CALLGLOBAL:
 						LogSilentF("%s\t'%s'\n", GetTTName(eType), X ? ((C4AulFunc *)X)->Name : ""); break;
+					case AB_CALL: case AB_CALLFS:
+						LogSilentF("%s\t'%s'\n", GetTTName(eType), ((C4AulCallCache *)X)->Func->Name); break;
 					case AB_STRING:
 						LogSilentF("%s\t'%s'\n", GetTTName(eType), X ? ((C4String *)X)->Data.getData() : ""); break;
 					default:
@@ -3599,6 +3610,43 @@ bool C4AulScript::Parse()
 	return true;
 }
 
+void C4AulScript::CombineInstructions()
+{
+	if (!Engine->Superinstructions) return;
+	// The superinstruction only replaces the first chunk of a sequence and skips the others when executed.
+	// All chunks stay in place, so jumps into a sequence and relative jump offsets remain valid.
+	for (int i = 0; i < CodeSize; i++)
+	{
+		C4AulBCC *pBCC = Code + i;
+		const int iRemaining = CodeSize - i;
+		switch (pBCC->bccType)
+		{
+		case AB_VARN_V:
+			if (iRemaining >= 4 &&
+				pBCC[1].bccType == AB_INT &&
+				Inside(pBCC[2].bccType, AB_LessThan, AB_GreaterThanEqual) &&
+				pBCC[3].bccType == AB_CONDN)
+				pBCC->bccType = AB_VARN_V_INT_CMP_CONDN;
+			break;
+
+		case AB_VARN_R:
+			if (iRemaining >= 3 &&
+				(pBCC[1].bccType == AB_Inc1 || pBCC[1].bccType == AB_Inc1_Postfix) &&
+				pBCC[2].bccType == AB_STACK && pBCC[2].bccX == -1)
+				pBCC->bccType = AB_VARN_R_INC1_STACK;
+			break;
+
+		case AB_PARN_V:
+			if (iRemaining >= 2 && pBCC[1].bccType == AB_FUNC)
+				pBCC->bccType = AB_PARN_V_FUNC;
+			break;
+
+		default:
+			break;
+		}
+	}
+}
+
 void C4AulScript::ParseDescs()
 {
 	// parse children
@@ -0,0 +1,848 @@
+/*
+ * LegacyClonk
+ *
+ * Copyright (c) 2019, The LegacyClonk Team and contributors
+ *
+ * Distributed under the terms of the ISC license; see accompanying file
+ * "COPYING" for details.
+ *
+ * "Clonk" is a registered trademark of Matthes Bender, used with permission.
+ * See accompanying file "TRADEMARK" for details.
+ *
+ * To redistribute this file separately, substitute the full license texts
+ * for the above references.
+ */
+
+// benchmarks and consistency checks of engine subsystems
+
+#include <C4Include.h>
+#include <C4Benchmark.h>
+
+#include <C4Application.h>
+#include <C4Components.h>
+#include <C4Config.h>
+#include <C4Control.h>
+#include <C4FindObject.h>
+#include <C4Game.h>
+#include <C4Group.h>
+#include <C4Log.h>
+#include <C4Object.h>
+#include <C4Random.h>
+#include <C4Script.h>
+#include <C4StringTable.h>
+#include <C4ValueList.h>
+#include <C4Wrappers.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	class C4BenchmarkTimer
+	{
+	public:
+		void Reset() { Start = std::chrono::steady_clock::now(); }
+		double GetMilliseconds() const { return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count(); }
+
+	private:
+		std::chrono::steady_clock::time_point Start = std::chrono::steady_clock::now();
+	};
+
+	// group cache
+
+	// Reads all entries of a group and its child groups in file order
+	// and returns the number of bytes read. The contents are hashed into iHash.
+	uint64_t ReadGroupContents(C4Group &hGroup, uint32_t &iHash)
+	{
+		// collect names first, because loading an entry restarts the entry search
+		std::vector<std::pair<std::string, bool>> Entries;
+		char szEntry[_MAX_FNAME + 1]; bool fChild;
+		hGroup.ResetSearch();
+		while (hGroup.FindNextEntry("*", szEntry, nullptr, &fChild))
+			Entries.emplace_back(szEntry, fChild);
+		uint64_t iBytes = 0;
+		StdBuf Buf;
+		for (const auto &Entry : Entries)
+		{
+			C4Group hChild;
+			if (Entry.second && hChild.OpenAsChild(&hGroup, Entry.first.c_str()))
+			{
+				iBytes += ReadGroupContents(hChild, iHash);
+				continue;
+			}
+			if (!hGroup.LoadEntry(Entry.first.c_str(), Buf)) continue;
+			iBytes += Buf.getSize();
+			iHash = crc32(iHash, static_cast<const Bytef *>(Buf.getData()), static_cast<uInt>(Buf.getSize()));
+		}
+		return iBytes;
+	}
+
+	// Reads the groups the engine loads on startup without cache, with an empty cache
+	// that has to be filled and with the images written by that second run.
+	bool BenchmarkGroupCache()
+	{
+		std::vector<std::string> Groups = { C4CFN_System, C4CFN_Graphics, C4CFN_Material };
+		char szDefinition[_MAX_PATH + 1];
+		for (int iSegment = 0; SCopySegment(Config.General.Definitions, iSegment, szDefinition, ';', _MAX_PATH); ++iSegment)
+			if (*szDefinition) Groups.emplace_back(szDefinition);
+		const StdStrBuf CachePath(Config.AtTempPath("GroupCacheBenchmark"), true);
+		EraseItem(CachePath.getData());
+		const struct { const char *szName; bool fCache; } Runs[] =
+		{
+			{ "uncached", false }, // also reads the packed groups into the file system cache for the other runs
+			{ "cold cache", true },
+			{ "warm cache", true }
+		};
+		bool fSuccess = true;
+		uint32_t iExpectedHash = 0;
+		for (const auto &Run : Runs)
+		{
+			C4Group_SetCachePath(Run.fCache ? CachePath.getData() : nullptr, (std::numeric_limits<uint64_t>::max)());
+			uint32_t iHash = 0;
+			uint64_t iBytes = 0;
+			int iGroups = 0;
+			C4BenchmarkTimer Timer;
+			for (const auto &Group : Groups)
+			{
+				C4Group hGroup;
+				if (!hGroup.Open(Group.c_str())) continue;
+				iBytes += ReadGroupContents(hGroup, iHash);
+				++iGroups;
+			}
+			const double dTime = Timer.GetMilliseconds();
+			if (!iGroups)
+			{
+				Log("No startup groups found to read");
+				fSuccess = false;
+				break;
+			}
+			LogF("%s: %d groups, %" PRIu64 " bytes in %.1f ms", Run.szName, iGroups, iBytes, dTime);
+			// every run has to read the same contents
+			if (&Run == Runs) iExpectedHash = iHash;
+			else if (iHash != iExpectedHash)
+			{
+				LogF("%s: contents differ from uncached read", Run.szName);
+				fSuccess = false;
+			}
+		}
+		// the game does not run after benchmarks, so the cache stays disabled
+		C4Group_SetCachePath(nullptr, 0);
+		EraseItem(CachePath.getData());
+		return fSuccess;
+	}
+
+	// synthetic world
+
+	// Materials loosely modeled on those of Material.c4g, so benchmarks do not depend on the game data
+	const char *const BenchmarkMaterials[] =
+	{
+		"[Material]\nName=Vehicle\nColor=100,100,100,100,100,100,100,100,100\nDensity=100\nFriction=100\nPlacement=5\n",
+		"[Material]\nName=Tunnel\nColor=60,40,20,60,40,20,60,40,20\nDensity=0\nPlacement=5\n",
+		"[Material]\nName=Earth\nColor=150,100,50,130,90,40,110,80,30\nDensity=50\nFriction=100\nDigFree=1\nSoil=1\nCorrode=1\nPlacement=40\n",
+		"[Material]\nName=Sand\nColor=230,200,120,210,180,100,190,160,80\nDensity=50\nFriction=30\nDigFree=1\nWindDrift=20\nPlacement=40\n",
+		"[Material]\nName=Rock\nColor=120,110,100,100,90,80,80,70,60\nDensity=50\nFriction=100\nCorrode=1\nPlacement=60\n",
+		"[Material]\nName=Granite\nColor=90,90,100,70,70,80,50,50,60\nDensity=50\nFriction=100\nPlacement=70\n",
+		"[Material]\nName=Water\nColor=40,80,200,30,70,190,20,60,180\nDensity=25\nFriction=10\nDigFree=1\nBlastFree=1\nMaxAirSpeed=100\nMaxSlide=100\nWindDrift=40\nExtinguisher=1\n"
+		"BelowTempConvert=-1\nBelowTempConvertDir=0\nBelowTempConvertTo=Ice-Smooth\nTempConvStrength=10\nPlacement=10\n",
+		"[Material]\nName=Acid\nColor=40,200,40,30,190,30,20,180,20\nDensity=25\nFriction=10\nDigFree=1\nBlastFree=1\nMaxAirSpeed=100\nMaxSlide=100\nWindDrift=40\nCorrosive=1\nPlacement=10\n",
+		"[Material]\nName=Snow\nColor=250,250,250,240,240,245,230,230,240\nDensity=50\nFriction=50\nDigFree=1\nWindDrift=60\n"
+		"AboveTempConvert=5\nAboveTempConvertDir=1\nAboveTempConvertTo=Water-Smooth\nTempConvStrength=10\nPlacement=30\n",
+		"[Material]\nName=Ice\nColor=200,220,250,190,210,245,180,200,240\nDensity=50\nFriction=10\nDigFree=1\n"
+		"AboveTempConvert=5\nAboveTempConvertDir=1\nAboveTempConvertTo=Water-Smooth\nTempConvStrength=10\nPlacement=30\n"
+	};
+
+	// Definitions without graphics for object benchmarks
+	const char *const BenchmarkDefinitions[] =
+	{
+		"[DefCore]\nid=ROCK\nName=Rock\nVersion=4,9,5\nCategory=C4D_Object\nWidth=6\nHeight=6\nOffset=-3,-3\n"
+		"Vertices=1\nVertexFriction=50\nValue=1\nMass=10\n",
+		"[DefCore]\nid=CRTE\nName=Crate\nVersion=4,9,5\nCategory=C4D_Vehicle\nWidth=12\nHeight=12\nOffset=-6,-6\n"
+		"Vertices=4\nVertexX=-5,5,-5,5\nVertexY=-5,-5,5,5\nVertexFriction=50,50,50,50\nValue=5\nMass=50\n",
+		"[DefCore]\nid=TREE\nName=Tree\nVersion=4,9,5\nCategory=C4D_StaticBack|C4D_SelectVegetation\nWidth=20\nHeight=40\nOffset=-10,-20\n"
+		"Value=10\nMass=200\n"
+	};
+
+	// Materials and a landscape created from a classic map or a Landscape.txt script
+	// in a temporary scenario folder, without any game data
+	class C4BenchmarkWorld
+	{
+	public:
+		~C4BenchmarkWorld() { Clear(); }
+
+		bool Init(int32_t iMapWdt, int32_t iMapHgt, int32_t iSeed, const char *szLandscapeScript = nullptr);
+		bool InitObjects(const char *szScript = nullptr); // definitions, object list and scenario script
+		void Clear();
+		uint32_t GetLandscapeChecksum() const;
+
+	private:
+		StdStrBuf Path;
+
+		bool CreateFiles(const char *szLandscapeScript);
+	};
+
+	bool C4BenchmarkWorld::CreateFiles(const char *szLandscapeScript)
+	{
+		const StdStrBuf MaterialPath = Path + DirSep C4CFN_Material;
+		if (!CreateDirectory(Path.getData()) || !CreateDirectory(MaterialPath.getData())) return false;
+		StdStrBuf TexMap;
+		int iIndex = 0;
+		for (const char *szMaterial : BenchmarkMaterials)
+		{
+			char szName[C4M_MaxName + 1];
+			SCopyUntil(SSearch(szMaterial, "Name="), szName, '\n', C4M_MaxName);
+			if (!StdStrBuf(szMaterial).SaveToFile(FormatString("%s" DirSep "%s.c4m", MaterialPath.getData(), szName).getData())) return false;
+			TexMap.AppendFormat("%d=%s-Smooth\n%d=%s-Rough\n", iIndex + 1, szName, iIndex + 2, szName);
+			iIndex += 2;
+		}
+		if (!TexMap.SaveToFile((MaterialPath + DirSep C4CFN_TexMap).getData())) return false;
+		// textures are noise only needed to create the landscape's color surface
+		for (const char *szTexture : { "Smooth", "Rough", "Liquid" })
+		{
+			CSurface8 Texture;
+			if (!Texture.Create(64, 64, true)) return false;
+			for (int y = 0; y < 64; ++y)
+				for (int x = 0; x < 64; ++x)
+					Texture.SetPix(x, y, static_cast<uint8_t>(SeededRandom((y << 6) + x, 3)));
+			if (!Texture.Save(FormatString("%s" DirSep "%s.bmp", MaterialPath.getData(), szTexture).getData())) return false;
+		}
+		if (szLandscapeScript)
+			if (!StdStrBuf(szLandscapeScript).SaveToFile((Path + DirSep C4CFN_DynLandscape).getData())) return false;
+		return true;
+	}
+
+	bool C4BenchmarkWorld::Init(int32_t iMapWdt, int32_t iMapHgt, int32_t iSeed, const char *szLandscapeScript)
+	{
+		Clear();
+		Path.Copy(Config.AtTempPath("Benchmark.c4s"));
+		EraseItem(Path.getData());
+		if (!CreateFiles(szLandscapeScript))
+		{
+			LogF("Could not create benchmark scenario in %s", Path.getData());
+			return false;
+		}
+		// classic map with a lake and some layers
+		Game.C4S.Default();
+		C4SLandscape &Landscape = Game.C4S.Landscape;
+		Landscape.MapWdt.Set(iMapWdt, 0, 64, 10000);
+		Landscape.MapHgt.Set(iMapHgt, 0, 40, 10000);
+		Landscape.LiquidLevel.Set(30);
+		Landscape.Amplitude.Set(30);
+		Landscape.Random.Set(20);
+		const std::pair<const char *, int32_t> Layers[] = { { "Rock", 20 }, { "Sand", 20 }, { "Granite", 10 }, { "Snow", 10 }, { "Ice", 10 }, { "Acid", 5 } };
+		for (size_t i = 0; i < std::size(Layers); ++i)
+		{
+			SCopy(Layers[i].first, Landscape.Layers.Name[i], C4MaxName);
+			Landscape.Layers.Count[i] = Layers[i].second;
+		}
+		Game.Parameters.RandomSeed = iSeed;
+		Game.FixRandom(iSeed);
+		// materials, like C4Game::InitMaterialTexture
+		C4Group hScenario, hMaterials;
+		if (!hScenario.Open(Path.getData()) || !hMaterials.OpenAsChild(&hScenario, C4CFN_Material)) return false;
+		Game.TextureMap.LoadMap(hMaterials, C4CFN_TexMap, nullptr, nullptr);
+		if (!Game.TextureMap.LoadTextures(hMaterials) || !Game.Material.Load(hMaterials)) return false;
+		hMaterials.Close();
+		Game.TextureMap.Init();
+		Game.Material.CrossMapMaterials();
+		if (!Game.EnumerateMaterials()) return false;
+		// landscape
+		bool fLoaded = false;
+		if (!Game.Landscape.Init(hScenario, false, false, fLoaded, false))
+		{
+			Log("Could not create benchmark landscape");
+			return false;
+		}
+		Game.Landscape.ScenarioInit();
+		Game.Weather.Temperature = 20;
+		return true;
+	}
+
+	bool C4BenchmarkWorld::InitObjects(const char *szScript)
+	{
+		for (const char *szDefCore : BenchmarkDefinitions)
+		{
+			char szID[C4MaxName + 1];
+			SCopyUntil(SSearch(szDefCore, "id="), szID, '\n', C4MaxName);
+			const StdStrBuf DefPath = FormatString("%s" DirSep "%s.c4d", Path.getData(), szID);
+			if (!CreateDirectory(DefPath.getData()) || !StdStrBuf(szDefCore).SaveToFile((DefPath + DirSep C4CFN_DefCore).getData())) return false;
+			// plain graphics of the definition's size
+			const int iWdt = atoi(SSearch(szDefCore, "Width=")), iHgt = atoi(SSearch(szDefCore, "Height="));
+			CSurface8 Graphics;
+			if (!Graphics.Create(iWdt, iHgt, true)) return false;
+			Graphics.Box(0, 0, iWdt - 1, iHgt - 1, 1);
+			if (!Graphics.Save((DefPath + DirSep C4CFN_DefGraphics).getData())) return false;
+		}
+		if (szScript)
+			if (!StdStrBuf(szScript).SaveToFile((Path + DirSep "Script.c").getData())) return false;
+		// definitions, like C4Game::InitDefs
+		C4Group hScenario;
+		if (!hScenario.Open(Path.getData())) return false;
+		if (Game.Defs.Load(hScenario, C4D_Load_Bitmap | C4D_Load_Script, Config.General.LanguageEx, nullptr, true, false, 0, 0, false) != static_cast<int32_t>(std::size(BenchmarkDefinitions)))
+		{
+			Log("Could not load benchmark definitions");
+			return false;
+		}
+		Game.Defs.BuildTable();
+		Game.Objects.Init(GBackWdt, GBackHgt, Game.C4S.Landscape.SectorSize);
+		Game.ObjectEnumerationIndex = 0;
+		// scripts, like C4Game::InitScriptEngine and C4Game::LinkScriptEngine
+		InitFunctionMap(&Game.ScriptEngine);
+		Game.Script.Reg2List(&Game.ScriptEngine, &Game.ScriptEngine);
+		if (szScript)
+			if (!Game.Script.Load("Script", hScenario, C4CFN_Script, Config.General.LanguageEx, nullptr, nullptr)) return false;
+		Game.ScriptEngine.Link(&Game.Defs);
+		Game.ScriptEngine.GlobalNamed.SetNameList(&Game.ScriptEngine.GlobalNamedNames);
+		return !szScript || Game.Script.IsReady();
+	}
+
+	void C4BenchmarkWorld::Clear()
+	{
+		// like C4Game::Clear and C4Game::Default
+		Game.DeleteObjects(true);
+		Game.Objects.Default();
+		Game.Defs.Clear(); Game.Defs.Default();
+		Game.PXS.Clear(); Game.PXS.Default();
+		Game.MassMover.Clear(); Game.MassMover.Default();
+		Game.Landscape.Clear(); Game.Landscape.Default();
+		Game.Material.Clear(); Game.Material.Default();
+		Game.TextureMap.Clear(); Game.TextureMap.Default();
+		Game.Weather.Clear(); Game.Weather.Default();
+		Game.Script.Clear();
+		Game.ScriptEngine.Clear();
+		Game.C4S.Default();
+		if (Path) EraseItem(Path.getData());
+		Path.Clear();
+	}
+
+	uint32_t C4BenchmarkWorld::GetLandscapeChecksum() const
+	{
+		uint32_t iCRC = 0;
+		std::vector<uint8_t> Row(GBackWdt);
+		for (int32_t y = 0; y < GBackHgt; ++y)
+		{
+			for (int32_t x = 0; x < GBackWdt; ++x) Row[x] = GBackPix(x, y);
+			iCRC = crc32(iCRC, Row.data(), static_cast<uInt>(Row.size()));
+		}
+		return iCRC;
+	}
+
+	// State compared between runs of the same simulation: the values of the network sync check,
+	// plus checksums of the PXS and the landscape, which the sync check does not cover
+	StdBuf GetSyncState(const C4BenchmarkWorld &World)
+	{
+		C4ControlSyncCheck SyncCheck;
+		SyncCheck.Set();
+		StdBuf State = DecompileToBuf<StdCompilerBinWrite>(SyncCheck);
+		const uint32_t Checksums[] = { Game.PXS.GetChecksum(), World.GetLandscapeChecksum() };
+		State.Append(Checksums, sizeof(Checksums));
+		return State;
+	}
+
+	// Compares the states of a run with those of the reference run; logs the first difference
+	bool CompareSyncStates(const char *szRun, const std::vector<StdBuf> &Reference, const std::vector<StdBuf> &States)
+	{
+		for (size_t i = 0; i < Reference.size(); ++i)
+			if (i >= States.size() || !(Reference[i] == States[i]))
+			{
+				LogF("%s: desync in frame %d", szRun, static_cast<int>(i));
+				return false;
+			}
+		return true;
+	}
+
+	// PXS
+
+	// Moves PXS of all kinds of materials over the same landscape for some frames on a single thread
+	// and on several threads, and compares the sync state of every frame.
+	bool TestPXS()
+	{
+		const int32_t iFrames = 300, iPXS = 10000, iRain = 100, iSeed = 4711;
+		const int32_t iThreadCounts[] = { 1, (std::max)(static_cast<int32_t>(std::thread::hardware_concurrency()), 2) };
+		std::vector<StdBuf> Reference;
+		bool fSuccess = true;
+		for (const int32_t iThreads : iThreadCounts)
+		{
+			C4BenchmarkWorld World;
+			if (!World.Init(100, 50, iSeed)) return false;
+			Application.ThreadPool.SetThreadCount(iThreads);
+			Game.FrameCounter = 0;
+			const int32_t Mats[] = { MWater, Game.Material.Get("Acid"), Game.Material.Get("Sand"), MSnow };
+			const auto Cast = [&Mats](int32_t iCount)
+			{
+				for (int32_t i = 0; i < iCount; ++i)
+					Game.PXS.Create(Mats[Random(std::size(Mats))], itofix(Random(GBackWdt)), itofix(Random(GBackHgt / 2)), FIXED10(Random(21) - 10), Fix0);
+			};
+			Cast(iPXS);
+			std::vector<StdBuf> States;
+			double dTime = 0;
+			for (int32_t iFrame = 0; iFrame < iFrames; ++iFrame)
+			{
+				// keep it raining
+				Cast(iRain);
+				C4BenchmarkTimer Timer;
+				Game.PXS.Execute();
+				dTime += Timer.GetMilliseconds();
+				++Game.FrameCounter;
+				States.push_back(GetSyncState(World));
+			}
+			const StdStrBuf Run = FormatString("%d thread(s)", static_cast<int>(iThreads));
+			LogF("%s: %d frames in %.1f ms", Run.getData(), static_cast<int>(iFrames), dTime);
+			if (Reference.empty()) Reference = std::move(States);
+			else if (!CompareSyncStates(Run.getData(), Reference, States)) fSuccess = false;
+		}
+		Application.ThreadPool.SetThreadCount(Config.General.WorkerThreads);
+		return fSuccess;
+	}
+
+	// landscape scan
+
+	// Freezes and melts the same landscape with the column-skipping and with the full
+	// material temperature conversion scan, and compares the landscape of every frame.
+	bool TestScan()
+	{
+		const int32_t iFrames = 2000, iPhaseFrames = 500, iSeed = 4711;
+		std::vector<uint32_t> Reference;
+		bool fSuccess = true;
+		for (const bool fSkip : { false, true })
+		{
+			C4BenchmarkWorld World;
+			if (!World.Init(100, 50, iSeed)) return false;
+			Game.Landscape.SetScanColumnSkip(fSkip);
+			std::vector<uint32_t> Checksums;
+			double dTime = 0;
+			for (int32_t iFrame = 0; iFrame < iFrames; ++iFrame)
+			{
+				// every phase is long enough for the scan to pass all columns once
+				Game.Weather.Temperature = (iFrame / iPhaseFrames) % 2 ? 30 : -30;
+				C4BenchmarkTimer Timer;
+				Game.Landscape.Execute();
+				dTime += Timer.GetMilliseconds();
+				Checksums.push_back(World.GetLandscapeChecksum());
+			}
+			const char *const szRun = fSkip ? "column skipping scan" : "full scan";
+			LogF("%s: %d frames in %.1f ms", szRun, static_cast<int>(iFrames), dTime);
+			if (Reference.empty())
+			{
+				// a landscape that is never converted would not test anything
+				if (std::count(Checksums.begin(), Checksums.end(), Checksums.front()) == iFrames)
+				{
+					Log("No material was converted");
+					return false;
+				}
+				Reference = std::move(Checksums);
+			}
+			else
+				for (size_t i = 0; i < Reference.size(); ++i)
+					if (Reference[i] != Checksums[i])
+					{
+						LogF("%s: landscape differs in frame %d", szRun, static_cast<int>(i));
+						fSuccess = false;
+						break;
+					}
+		}
+		return fSuccess;
+	}
+
+	// script
+
+	// Functions of the script benchmark; each one is called once and returns a checksum of its work
+	const char *const BenchmarkScriptSource =
+		"#strict 2\n"
+		"\n"
+		"func Loops()\n"
+		"{\n"
+		"  var iSum = 0;\n"
+		"  for (var i = 0; i < 2000000; ++i)\n"
+		"    if (i % 3 == 0) iSum += i % 7;\n"
+		"  return iSum;\n"
+		"}\n"
+		"\n"
+		"func Arrays()\n"
+		"{\n"
+		"  var a = [];\n"
+		"  for (var i = 0; i < 1000; ++i) a[i] = i;\n"
+		"  var iSum = 0;\n"
+		"  for (var j = 0; j < 1000; ++j)\n"
+		"    for (var i = 0; i < 1000; ++i) iSum += a[i] % 10;\n"
+		"  return iSum;\n"
+		"}\n"
+		"\n"
+		"func Calls()\n"
+		"{\n"
+		"  var iSum = 0;\n"
+		"  for (var i = 0; i < 300000; ++i) iSum += Twice(i % 1000);\n"
+		"  return iSum;\n"
+		"}\n"
+		"\n"
+		"func Twice(x) { return Inc(x) + Inc(x); }\n"
+		"func Inc(x) { return x + 1; }\n";
+
+	// Runs the benchmark script with and without superinstructions. The executed chunks are counted
+	// by the script profiler in a separate call, because counting slows down execution.
+	bool BenchmarkScript()
+	{
+		const char *const Funcs[] = { "Loops", "Arrays", "Calls" };
+		const StdStrBuf Path(Config.AtTempPath("ScriptBenchmark.c4s"), true);
+		EraseItem(Path.getData());
+		C4Group hScenario;
+		if (!CreateDirectory(Path.getData()) || !StdStrBuf(BenchmarkScriptSource).SaveToFile((Path + DirSep "Script.c").getData()) || !hScenario.Open(Path.getData()))
+		{
+			LogF("Could not create benchmark scenario in %s", Path.getData());
+			return false;
+		}
+		InitFunctionMap(&Game.ScriptEngine);
+		Game.Script.Reg2List(&Game.ScriptEngine, &Game.ScriptEngine);
+		bool fSuccess = Game.Script.Load("Script", hScenario, C4CFN_Script, Config.General.LanguageEx, nullptr, nullptr);
+		hScenario.Close();
+		// instructions of every function without superinstructions, so both runs are rated by the same work
+		uint64_t iInstructions[std::size(Funcs)] = {};
+		C4Value Results[std::size(Funcs)];
+		for (const bool fSuperinstructions : { false, true })
+		{
+			Game.ScriptEngine.Superinstructions = fSuperinstructions;
+			Game.ScriptEngine.ReLink(&Game.Defs);
+			if (!fSuccess || !Game.Script.IsReady() || !std::all_of(std::begin(Funcs), std::end(Funcs), [](const char *szFunc) { return Game.Script.GetSFunc(szFunc); }))
+			{
+				Log("Could not compile the benchmark script");
+				fSuccess = false;
+				break;
+			}
+			const char *const szRun = fSuperinstructions ? "with superinstructions" : "without superinstructions";
+			for (size_t i = 0; i < std::size(Funcs); ++i)
+			{
+				C4AulProfiler::StartProfiling(&Game.Script);
+				Game.Script.Call(Funcs[i]);
+				const uint64_t iChunks = C4AulProfiler::GetExecutedChunks();
+				C4AulProfiler::Abort();
+				if (!fSuperinstructions) iInstructions[i] = iChunks;
+				// best of some calls, to be less affected by other processes
+				C4Value Result;
+				double dTime = (std::numeric_limits<double>::max)();
+				for (int iRepetition = 0; iRepetition < 3; ++iRepetition)
+				{
+					C4BenchmarkTimer Timer;
+					Result = Game.Script.Call(Funcs[i]);
+					dTime = (std::min)(dTime, Timer.GetMilliseconds());
+				}
+				LogF("%s %s: %" PRIu64 " chunks dispatched for %" PRIu64 " instructions in %.1f ms, %.1f million instructions/s",
+					Funcs[i], szRun, iChunks, iInstructions[i], dTime, iInstructions[i] / dTime / 1000);
+				// superinstructions must not change results
+				if (!fSuperinstructions) Results[i] = Result;
+				else if (Result != Results[i])
+				{
+					LogF("%s %s: returned %s instead of %s", Funcs[i], szRun, Result.GetDataString().getData(), Results[i].GetDataString().getData());
+					fSuccess = false;
+				}
+			}
+		}
+		Game.ScriptEngine.Superinstructions = true;
+		Game.Script.Clear();
+		Game.ScriptEngine.Clear();
+		EraseItem(Path.getData());
+		return fSuccess;
+	}
+
+	// string table
+
+	// Registers and looks up distinct strings through the contents index, and compares some
+	// lookups with a walk over the string list, which is how strings were looked up before.
+	bool BenchmarkStrings()
+	{
+		const int iStrings = 100000, iLinearLookups = 1000;
+		std::vector<std::string> Strings;
+		Strings.reserve(iStrings);
+		for (int i = 0; i < iStrings; ++i) Strings.emplace_back(FormatString("String%d", i).getData());
+		C4StringTable Table;
+		C4BenchmarkTimer Timer;
+		for (const auto &String : Strings) Table.RegString(String.c_str());
+		LogF("register: %.1f ns/op", Timer.GetMilliseconds() * 1e6 / iStrings);
+		bool fSuccess = true;
+		Timer.Reset();
+		for (const auto &String : Strings)
+		{
+			C4String *const pString = Table.FindString(String.c_str());
+			if (!pString || !SEqual(pString->Data.getData(), String.c_str())) fSuccess = false;
+		}
+		LogF("indexed lookup: %.1f ns/op", Timer.GetMilliseconds() * 1e6 / iStrings);
+		Timer.Reset();
+		for (int i = 0; i < iLinearLookups; ++i)
+		{
+			const char *const szString = Strings[i * (iStrings / iLinearLookups)].c_str();
+			C4String *pString = Table.First;
+			while (pString && !SEqual(pString->Data.getData(), szString)) pString = pString->Next;
+			if (pString != Table.FindString(szString)) fSuccess = false;
+		}
+		LogF("linear lookup: %.1f ns/op", Timer.GetMilliseconds() * 1e6 / iLinearLookups);
+		if (!fSuccess) Log("Indexed lookup did not find the registered strings");
+		return fSuccess;
+	}
+
+	// FindObject
+
+	// Searches done by the benchmark scenario script every frame; the result combines found object counts and numbers
+	const char *const FindObjectsScript =
+		"#strict 2\n"
+		"\n"
+		"func FindFrame(int iFrame)\n"
+		"{\n"
+		"  var x = iFrame * 37 % LandscapeWidth(), y = iFrame * 23 % LandscapeHeight();\n"
+		"  var iFound = GetLength(FindObjects([C4FO_ID, TREE]));\n"
+		"  iFound += GetLength(FindObjects([C4FO_ID, ROCK], [C4FO_InRect, x - 100, y - 100, 200, 200]));\n"
+		"  iFound += GetLength(FindObjects([C4FO_Category, C4D_Vehicle], [C4FO_Distance, x, y, 150]));\n"
+		"  iFound += GetLength(FindObjects([C4FO_InRect, x - 50, y - 50, 100, 100]));\n"
+		"  iFound += ObjectCount2([C4FO_ID, CRTE], [C4FO_InRect, 0, 0, LandscapeWidth() / 2, LandscapeHeight()]);\n"
+		"  return iFound * 10000 + ObjectNumber(FindObject2([C4FO_ID, CRTE], [C4SO_Distance, x, y]));\n"
+		"}\n";
+
+	// Runs the FindObject calls of the benchmark script over 5000 objects with and without the id and category indices
+	bool BenchmarkFindObjects()
+	{
+		const int32_t iFrames = 500, iSeed = 4711;
+		const std::pair<C4ID, int32_t> Objects[] = { { C4Id("ROCK"), 2500 }, { C4Id("CRTE"), 2000 }, { C4Id("TREE"), 500 } };
+		C4BenchmarkWorld World;
+		if (!World.Init(200, 100, iSeed) || !World.InitObjects(FindObjectsScript)) return false;
+		for (const auto &Object : Objects)
+			for (int32_t i = 0; i < Object.second; ++i)
+				Game.CreateObject(Object.first, nullptr, NO_OWNER, Random(GBackWdt), Random(GBackHgt));
+		LogF("%d objects in a %dx%d landscape", static_cast<int>(Game.Objects.ObjectCount()), static_cast<int>(GBackWdt), static_cast<int>(GBackHgt));
+		std::vector<int32_t> Reference;
+		bool fSuccess = true;
+		for (const bool fUseIndexLists : { false, true })
+		{
+			C4FindObject::UseIndexLists = fUseIndexLists;
+			std::vector<int32_t> Results;
+			C4BenchmarkTimer Timer;
+			for (int32_t iFrame = 0; iFrame < iFrames; ++iFrame)
+			{
+				C4AulParSet Pars(C4VInt(iFrame));
+				Results.push_back(Game.Script.Call("FindFrame", &Pars).getInt());
+			}
+			const char *const szRun = fUseIndexLists ? "with indices" : "without indices";
+			LogF("%s: %d frames in %.1f ms", szRun, static_cast<int>(iFrames), Timer.GetMilliseconds());
+			if (Reference.empty()) Reference = std::move(Results);
+			else if (Results != Reference)
+			{
+				LogF("%s: different objects found", szRun);
+				fSuccess = false;
+			}
+		}
+		C4FindObject::UseIndexLists = true;
+		return fSuccess;
+	}
+
+	// object sectors
+
+	// Counts the objects in a rect by walking the sector lists of its area; without block skipping,
+	// every sector list is visited as before the coarse grid was added
+	int32_t CountObjectsInRect(C4Rect Rect, bool fSkipEmptyBlocks)
+	{
+		C4LArea Area(&Game.Objects.Sectors, Rect);
+		int32_t iCount = 0;
+		const auto CountList = [&Rect, &iCount](C4ObjectList *pList)
+		{
+			for (C4ObjectLink *pLnk = pList->First; pLnk; pLnk = pLnk->Next)
+				if (Rect.Contains(pLnk->Obj->x, pLnk->Obj->y)) ++iCount;
+		};
+		C4LSector *pSct;
+		if (fSkipEmptyBlocks)
+			for (C4ObjectList *pList = Area.FirstObjects(&pSct); pList; pList = Area.NextObjects(pList, &pSct))
+				CountList(pList);
+		else
+			for (pSct = Area.First(); pSct; pSct = Area.Next(pSct))
+				CountList(&pSct->Objects);
+		return iCount;
+	}
+
+	// Searches small, medium and whole map rects of a 4000x2000 map with clustered objects
+	// for several sector sizes, with and without skipping empty sector blocks
+	bool BenchmarkSectors()
+	{
+		const int32_t iSeed = 4711, iClusters = 5, iClusterObjects = 400, iClusterRadius = 150;
+		C4BenchmarkWorld World;
+		if (!World.Init(400, 200, iSeed) || !World.InitObjects()) return false;
+		for (int32_t i = 0; i < iClusters; ++i)
+		{
+			const int32_t x = iClusterRadius + Random(GBackWdt - 2 * iClusterRadius), y = iClusterRadius + Random(GBackHgt - 2 * iClusterRadius);
+			for (int32_t j = 0; j < iClusterObjects; ++j)
+				Game.CreateObject(C4Id("ROCK"), nullptr, NO_OWNER, x + Random(2 * iClusterRadius) - iClusterRadius, y + Random(2 * iClusterRadius) - iClusterRadius);
+		}
+		LogF("%d objects in %d clusters in a %dx%d landscape", static_cast<int>(Game.Objects.ObjectCount()), static_cast<int>(iClusters), static_cast<int>(GBackWdt), static_cast<int>(GBackHgt));
+		const struct { const char *szName; int32_t iWdt, iHgt, iQueries; } Rects[] =
+		{
+			{ "small", 100, 100, 200000 },
+			{ "medium", 800, 800, 20000 },
+			{ "whole map", GBackWdt, GBackHgt, 2000 }
+		};
+		bool fSuccess = true;
+		for (const int32_t iSectorSize : { 25, 50, 100, 200 })
+		{
+			// sort all objects into new sectors
+			Game.Objects.Sectors.Init(GBackWdt, GBackHgt, iSectorSize);
+			for (C4ObjectLink *pLnk = Game.Objects.First; pLnk; pLnk = pLnk->Next)
+				Game.Objects.Sectors.Add(pLnk->Obj, &Game.Objects);
+			for (const auto &Rect : Rects)
+			{
+				double dTimes[2];
+				int64_t iFound[2];
+				for (const bool fSkipEmptyBlocks : { false, true })
+				{
+					// the same rects for every run
+					FixedRandom(iSeed);
+					int64_t iCount = 0;
+					C4BenchmarkTimer Timer;
+					for (int32_t i = 0; i < Rect.iQueries; ++i)
+						iCount += CountObjectsInRect(C4Rect(Random(GBackWdt - Rect.iWdt + 1), Random(GBackHgt - Rect.iHgt + 1), Rect.iWdt, Rect.iHgt), fSkipEmptyBlocks);
+					dTimes[fSkipEmptyBlocks] = Timer.GetMilliseconds() * 1000 / Rect.iQueries;
+					iFound[fSkipEmptyBlocks] = iCount;
+				}
+				LogF("%d px sectors, %s rects: %.2f us/query walking all sectors, %.2f us/query skipping empty blocks",
+					static_cast<int>(iSectorSize), Rect.szName, dTimes[false], dTimes[true]);
+				if (iFound[false] != iFound[true])
+				{
+					LogF("%d px sectors, %s rects: skipping empty blocks found different objects", static_cast<int>(iSectorSize), Rect.szName);
+					fSuccess = false;
+				}
+			}
+		}
+		return fSuccess;
+	}
+
+	// object lists
+
+	// Removes all objects of a list in random order and adds them again; returns ns per removal and addition
+	double ChurnObjectList(C4ObjectList &List, const std::vector<C4Object *> &Objects, int32_t iSeed, int32_t iRounds)
+	{
+		FixedRandom(iSeed);
+		std::vector<C4Object *> Order(Objects);
+		C4BenchmarkTimer Timer;
+		for (int32_t i = 0; i < iRounds; ++i)
+		{
+			for (size_t j = Order.size() - 1; j > 0; --j) std::swap(Order[j], Order[Random(static_cast<int32_t>(j) + 1)]);
+			for (C4Object *pObj : Order) List.Remove(pObj);
+			for (C4Object *pObj : Order) List.Add(pObj, C4ObjectList::stNone);
+		}
+		return Timer.GetMilliseconds() * 1e6 / (iRounds * Order.size() * 2);
+	}
+
+	// Executes 5000 falling and resting objects, and removes and adds objects of lists with and without number index
+	bool BenchmarkObjects()
+	{
+		const int32_t iFrames = 200, iChurnRounds = 5, iSeed = 4711;
+		const std::pair<C4ID, int32_t> ObjectCounts[] = { { C4Id("ROCK"), 2500 }, { C4Id("CRTE"), 2000 }, { C4Id("TREE"), 500 } };
+		C4BenchmarkWorld World;
+		if (!World.Init(200, 100, iSeed) || !World.InitObjects()) return false;
+		for (const auto &Object : ObjectCounts)
+			for (int32_t i = 0; i < Object.second; ++i)
+				Game.CreateObject(Object.first, nullptr, NO_OWNER, Random(GBackWdt), Random(GBackHgt));
+		LogF("%d objects in a %dx%d landscape", static_cast<int>(Game.Objects.ObjectCount()), static_cast<int>(GBackWdt), static_cast<int>(GBackHgt));
+		C4BenchmarkTimer Timer;
+		for (int32_t iFrame = 0; iFrame < iFrames; ++iFrame) Game.ExecObjects();
+		LogF("ExecObjects: %.3f ms/frame", Timer.GetMilliseconds() / iFrames);
+		// Lists without number index find the link of a removed object by walking the list, as all lists did before
+		std::vector<C4Object *> Objects;
+		for (C4ObjectLink *pLnk = Game.Objects.First; pLnk; pLnk = pLnk->Next) Objects.push_back(pLnk->Obj);
+		C4ObjectList Lists[2];
+		Lists[1].EnableNumberIndex();
+		double dTimes[2];
+		for (int i = 0; i < 2; ++i)
+		{
+			for (C4Object *pObj : Objects) Lists[i].Add(pObj, C4ObjectList::stNone);
+			dTimes[i] = ChurnObjectList(Lists[i], Objects, iSeed, iChurnRounds);
+		}
+		LogF("remove and add: %.1f ns/op walking the list, %.1f ns/op with number index", dTimes[0], dTimes[1]);
+		bool fSuccess = Lists[0].CheckSort(&Lists[1]) && Lists[1].CheckSort(&Lists[0]);
+		if (!fSuccess) Log("Lists with and without number index differ");
+		for (C4ObjectList &List : Lists) List.Clear();
+		return fSuccess;
+	}
+
+	// value references
+
+	// Overwrites random values of a growing number of references to one object; with constant time
+	// reference unlinking, the time per overwrite must not grow with the number of references.
+	// Finally, removing the object must clear all references.
+	bool BenchmarkValueReferences()
+	{
+		const int32_t iOverwrites = 1000000, iSeed = 4711;
+		C4BenchmarkWorld World;
+		if (!World.Init(100, 50, iSeed) || !World.InitObjects()) return false;
+		C4Object *const pObj = Game.CreateObject(C4Id("ROCK"), nullptr, NO_OWNER, GBackWdt / 2, 0);
+		if (!pObj) return false;
+		// half of the references are array elements, like those of script arrays
+		std::vector<C4Value> Values;
+		C4ValueArray Array;
+		for (const int32_t iReferences : { 1000, 10000, 100000 })
+		{
+			Values.assign(iReferences / 2, C4VObj(pObj));
+			Array.SetLength(iReferences - iReferences / 2);
+			for (int32_t i = 0; i < Array.GetSize(); ++i) Array[i] = C4VObj(pObj);
+			FixedRandom(iSeed);
+			C4BenchmarkTimer Timer;
+			for (int32_t i = 0; i < iOverwrites; ++i)
+			{
+				const int32_t iIndex = Random(iReferences);
+				C4Value &Value = iIndex < static_cast<int32_t>(Values.size()) ? Values[iIndex] : Array[iIndex - static_cast<int32_t>(Values.size())];
+				if (!Value) Value = C4VObj(pObj); else Value.Set0();
+			}
+			LogF("%d references: %.1f ns/overwrite", static_cast<int>(iReferences), Timer.GetMilliseconds() * 1e6 / iOverwrites);
+		}
+		pObj->AssignRemoval();
+		const auto IsCleared = [](const C4Value &Value) { return !Value; };
+		bool fSuccess = std::all_of(Values.begin(), Values.end(), IsCleared);
+		for (int32_t i = 0; i < Array.GetSize(); ++i) fSuccess = fSuccess && IsCleared(Array[i]);
+		if (!fSuccess) Log("Removing the object did not clear all references");
+		return fSuccess;
+	}
+
+	const struct C4BenchmarkDef
+	{
+		const char *szName;
+		const char *szDescription;
+		bool(*fnRun)();
+	} Benchmarks[] =
+	{
+		{ "groupcache",  "reading startup groups without, with cold and with warm group cache",                  &BenchmarkGroupCache },
+		{ "pxs",         "PXS on one and on several threads must stay in sync",                                  &TestPXS },
+		{ "scan",        "column skipping and full landscape scan must convert alike",                           &TestScan },
+		{ "script",      "script loops, array access and calls with and without superinstructions",              &BenchmarkScript },
+		{ "strings",     "registering and looking up 100000 strings in a string table",                          &BenchmarkStrings },
+		{ "findobjects", "FindObject calls over 5000 objects with and without id and category indices",          &BenchmarkFindObjects },
+		{ "sectors",     "area queries for several sector sizes with and without skipping empty sector blocks",  &BenchmarkSectors },
+		{ "objects",     "executing 5000 objects and removing objects from lists with and without number index", &BenchmarkObjects }
+	};
+}
+
+bool C4Benchmark::Run(const char *szNames)
+{
+	bool fSuccess = true;
+	char szName[C4MaxName + 1];
+	for (int iSegment = 0; SCopySegment(szNames, iSegment, szName, ',', C4MaxName); ++iSegment)
+	{
+		bool fFound = false;
+		for (const auto &Benchmark : Benchmarks)
+			if (SEqualNoCase(szName, "all") || SEqualNoCase(szName, Benchmark.szName))
+			{
+				fFound = true;
+				LogF("Benchmark %s: %s", Benchmark.szName, Benchmark.szDescription);
+				if (Benchmark.fnRun())
+					LogF("Benchmark %s: passed", Benchmark.szName);
+				else
+				{
+					LogF("Benchmark %s: FAILED", Benchmark.szName);
+					fSuccess = false;
+				}
+			}
+		if (!fFound)
+		{
+			LogF("Unknown benchmark: %s", szName);
+			fSuccess = false;
+		}
+	}
+	return fSuccess;
+}
@@ -0,0 +1,29 @@
+/*
+ * LegacyClonk
+ *
+ * Copyright (c) 2019, The LegacyClonk Team and contributors
+ *
+ * Distributed under the terms of the ISC license; see accompanying file
+ * "COPYING" for details.
+ *
+ * "Clonk" is a registered trademark of Matthes Bender, used with permission.
+ * See accompanying file "TRADEMARK" for details.
+ *
+ * To redistribute this file separately, substitute the full license texts
+ * for the above references.
+ */
+
+// benchmarks and consistency checks of engine subsystems
+
+#pragma once
+
+// Runs benchmarks selected by the /benchmark:<name>[,<name>...] command line option
+// instead of a game. Each one logs its timings and checks that optimized code paths
+// produce the same results as the reference ones they replace.
+class C4Benchmark
+{
+public:
+	// run the comma separated benchmarks ("all" for every one)
+	// returns false if a benchmark is unknown or one of its checks failed
+	static bool Run(const char *szNames);
+};
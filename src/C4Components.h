@@ -112,6 +112,8 @@
 
 #define C4CFN_Log    "Clonk.log"
 #define C4CFN_LogEx  "Clonk%d.log" // created if regular logfile is in use
+#define C4CFN_ScriptProfile       "ScriptProfile.txt"
+#define C4CFN_ScriptProfileStacks "ScriptProfile.folded"
 #define C4CFN_Names  "Names.txt"
 #define C4CFN_Titles "Title*.txt|Title.txt"
 
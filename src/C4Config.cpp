@@ -104,6 +104,9 @@ void C4ConfigGeneral::CompileFunc(StdCompiler *pComp)
 	pComp->Value(mkNamingAdapt(UseWhiteIngameChat,   "UseWhiteIngameChat",   false, false, true));
 	pComp->Value(mkNamingAdapt(UseWhiteLobbyChat,    "UseWhiteLobbyChat",    false, false, true));
 	pComp->Value(mkNamingAdapt(ShowLogTimestamps,    "ShowLogTimestamps",    false, false, true));
+	pComp->Value(mkNamingAdapt(WorkerThreads,        "WorkerThreads",        0,     false, true));
+	pComp->Value(mkNamingAdapt(GroupCache,           "GroupCache",           false, false, true));
+	pComp->Value(mkNamingAdapt(GroupCacheSize,       "GroupCacheSize",       1024,  false, true));
 }
 
 void C4ConfigDeveloper::CompileFunc(StdCompiler *pComp)
@@ -80,6 +80,9 @@ public:
 	bool UseWhiteIngameChat;
 	bool UseWhiteLobbyChat;
 	bool ShowLogTimestamps;
+	int32_t WorkerThreads; // threads for parallel engine tasks; 0: one per hardware thread, 1: no worker threads
+	bool GroupCache; // read packed groups from uncompressed images cached in the temp path
+	int32_t GroupCacheSize; // maximum size of those images in MiB
 
 public:
 	static int GetLanguageSequence(const char *strSource, char *strTarget);
@@ -32,6 +32,7 @@
 #include <C4Wrappers.h>
 #include <C4Object.h>
 #include "C4Network2Res.h"
+#include <StdPNG.h>
 #endif
 
 #ifdef C4GROUP
@@ -40,6 +41,15 @@
 #include "C4CompilerWrapper.h"
 #endif
 
+#include <algorithm>
+#include <stdexcept>
+
+namespace
+{
+	// number of sub definitions that are read and decoded together when loading in parallel
+	const size_t C4DefLoadBatchSize = 32;
+}
+
 // Default Action Procedures
 
 const char *ProcedureName[C4D_MaxDFA] =
@@ -230,35 +240,38 @@ bool C4DefCore::Load(C4Group &hGroup)
 		if (!Compile(Source.getData(), Name.getData()))
 			return false;
 		Source.Clear();
+		Validate(hGroup);
+		return true;
+	}
+	return false;
+}
 
-		// Adjust category: C4D_CrewMember by CrewMember flag
-		if (CrewMember) Category |= C4D_CrewMember;
+void C4DefCore::Validate(C4Group &hGroup)
+{
+	// Adjust category: C4D_CrewMember by CrewMember flag
+	if (CrewMember) Category |= C4D_CrewMember;
 
-		// Adjust picture rect
-		if ((PictureRect.Wdt == 0) || (PictureRect.Hgt == 0))
-			PictureRect.Set(0, 0, Shape.Wdt, Shape.Hgt);
+	// Adjust picture rect
+	if ((PictureRect.Wdt == 0) || (PictureRect.Hgt == 0))
+		PictureRect.Set(0, 0, Shape.Wdt, Shape.Hgt);
 
-		// Check category
+	// Check category
 #ifdef C4ENGINE
-		if (!(Category & C4D_SortLimit))
-		{
-			// special: Allow this for spells
-			if (~Category & C4D_Magic)
-				DebugLogF("WARNING: Def %s (%s) at %s has invalid category!", GetName(), C4IdText(id), hGroup.GetFullName().getData());
-			// assign a default category here
-			Category = (Category & ~C4D_SortLimit) | 1;
-		}
-		// Check mass
-		if (Mass < 0)
-		{
-			DebugLogF("WARNING: Def %s (%s) at %s has invalid mass!", GetName(), C4IdText(id), hGroup.GetFullName().getData());
-			Mass = 0;
-		}
-#endif
-
-		return true;
+	if (!(Category & C4D_SortLimit))
+	{
+		// special: Allow this for spells
+		if (~Category & C4D_Magic)
+			DebugLogF("WARNING: Def %s (%s) at %s has invalid category!", GetName(), C4IdText(id), hGroup.GetFullName().getData());
+		// assign a default category here
+		Category = (Category & ~C4D_SortLimit) | 1;
 	}
-	return false;
+	// Check mass
+	if (Mass < 0)
+	{
+		DebugLogF("WARNING: Def %s (%s) at %s has invalid mass!", GetName(), C4IdText(id), hGroup.GetFullName().getData());
+		Mass = 0;
+	}
+#endif
 }
 
 bool C4DefCore::Compile(const char *szSource, const char *szName)
@@ -538,7 +551,8 @@ void C4Def::Clear()
 bool C4Def::Load(C4Group &hGroup,
 	uint32_t dwLoadWhat,
 	const char *szLanguage,
-	C4SoundSystem *pSoundSystem)
+	C4SoundSystem *pSoundSystem,
+	C4DefLoadStage *pStage)
 {
 	bool fSuccess = true;
 
@@ -579,6 +593,16 @@ bool C4Def::Load(C4Group &hGroup,
 #endif
 
 	// Read DefCore
+#ifdef C4ENGINE
+	// already compiled by the def list?
+	if (fSuccess && pStage)
+	{
+		pStage->LogMessages();
+		fSuccess = pStage->fDefCoreLoaded;
+		if (fSuccess) Validate(hGroup);
+	}
+	else
+#endif
 	if (fSuccess) fSuccess = C4DefCore::Load(hGroup);
 	// check id
 	if (fSuccess) if (!LooksLikeID(id))
@@ -614,7 +638,7 @@ bool C4Def::Load(C4Group &hGroup,
 #ifdef C4ENGINE
 	// Read surface bitmap
 	if (dwLoadWhat & C4D_Load_Bitmap)
-		if (!Graphics.LoadBitmaps(hGroup, !!ColorByOwner))
+		if (!Graphics.LoadBitmaps(hGroup, !!ColorByOwner, pStage))
 		{
 			DebugLogF("  Error loading graphics of %s (%s)", hGroup.GetFullName().getData(), C4IdText(id));
 			return false;
@@ -959,6 +983,65 @@ void C4Def::Synchronize()
 
 #endif
 
+#ifdef C4ENGINE
+
+// C4DefLoadStage
+
+void C4DefLoadStage::Read(C4Group &hGroup, uint32_t dwLoadWhat)
+{
+	// only stage definitions; particle definitions and plain folders are loaded as usual
+	if (hGroup.FindEntry(C4CFN_ParticleCore) || !hGroup.LoadEntryString(C4CFN_DefCore, DefCoreSource)) return;
+	DefCoreMessages.Name = (hGroup.GetFullName() + DirSep C4CFN_DefCore).getData();
+	Def.reset(new C4Def);
+	// read PNG graphics, overlays and portraits
+	if (!(dwLoadWhat & C4D_Load_Bitmap)) return;
+	char szFilename[_MAX_FNAME + 1];
+	hGroup.ResetSearch();
+	while (hGroup.FindNextEntry(C4CFN_PNGFiles, szFilename))
+		if (WildcardMatch(C4CFN_DefGraphicsExPNG, szFilename) || WildcardMatch(C4CFN_ClrByOwnerExPNG, szFilename) || WildcardMatch(C4CFN_Portraits, szFilename))
+			Images.push_back({szFilename});
+	for (auto &Img : Images)
+		hGroup.LoadEntry(Img.Filename.c_str(), Img.Data);
+}
+
+void C4DefLoadStage::Decode()
+{
+	if (!Def) return;
+	// compile DefCore; log output is kept for the main thread
+	fDefCoreLoaded = CompileFromBuf_CollectWarn<StdCompilerINIRead>(mkNamingAdapt(static_cast<C4DefCore &>(*Def), "DefCore"), DefCoreSource, DefCoreMessages);
+	DefCoreSource.Clear();
+	// decode images; failed ones are loaded again by C4Surface::ReadPNG, which logs the error
+	for (auto &Img : Images)
+	{
+		try
+		{
+			CPNGFile png(Img.Data.getData(), Img.Data.getSize());
+			Img.Bitmap.reset(new StdBitmap(png.Width(), png.Height(), png.UsesAlpha()));
+			png.Decode(Img.Bitmap->GetBytes());
+		}
+		catch (const std::runtime_error &)
+		{
+			Img.Bitmap.reset();
+		}
+		Img.Data.Clear();
+	}
+}
+
+void C4DefLoadStage::LogMessages()
+{
+	DefCoreMessages.Log();
+}
+
+const StdBitmap *C4DefLoadStage::GetImage(const char *szFilename) const
+{
+	for (const auto &Img : Images)
+		if (SEqualNoCase(Img.Filename.c_str(), szFilename))
+			return Img.Bitmap.get();
+	return nullptr;
+}
+
+#endif
+
 // C4DefList
 
 C4DefList::C4DefList()
@@ -971,11 +1054,25 @@ C4DefList::~C4DefList()
 	Clear();
 }
 
+bool C4DefList::OpenSubDef(C4Group &hChild, C4Group &hGroup, const char *szEntryName, C4DefLoadStage *pStage)
+{
+#ifdef C4ENGINE
+	// open from the image kept by the stage; load the image first if the child is packed
+	if (pStage)
+	{
+		if (pStage->GroupImage.isNull()) hGroup.LoadChildImage(szEntryName, pStage->GroupImage);
+		if (!pStage->GroupImage.isNull() && hChild.OpenChildImage(&hGroup, szEntryName, pStage->GroupImage)) return true;
+	}
+#endif
+	return hChild.OpenAsChild(&hGroup, szEntryName);
+}
+
 int32_t C4DefList::Load(C4Group &hGroup, uint32_t dwLoadWhat,
 	const char *szLanguage,
 	C4SoundSystem *pSoundSystem,
 	bool fOverload,
-	bool fSearchMessage, int32_t iMinProgress, int32_t iMaxProgress, bool fLoadSysGroups)
+	bool fSearchMessage, int32_t iMinProgress, int32_t iMaxProgress, bool fLoadSysGroups,
+	C4DefLoadStage *pStage)
 {
 	int32_t iResult = 0;
 	C4Def *nDef;
@@ -999,29 +1096,63 @@ int32_t C4DefList::Load(C4Group &hGroup, uint32_t dwLoadWhat,
 #endif
 
 	// Load primary definition
-	if (nDef = new C4Def)
-		if (nDef->Load(hGroup, dwLoadWhat, szLanguage, pSoundSystem) && Add(nDef, fOverload))
-		{
-			iResult++; fPrimaryDef = true;
-		}
-		else
-		{
-			delete nDef;
-		}
+	if (pStage && !pStage->Def) pStage = nullptr;
+	nDef = pStage ? pStage->Def.release() : new C4Def;
+	if (nDef->Load(hGroup, dwLoadWhat, szLanguage, pSoundSystem, pStage) && Add(nDef, fOverload))
+	{
+		iResult++; fPrimaryDef = true;
+	}
+	else
+	{
+		delete nDef;
+	}
 
 	// Load sub definitions
-	int i = 0;
+	std::vector<std::string> SubDefs;
 	hGroup.ResetSearch();
 	while (hGroup.FindNextEntry(C4CFN_DefFiles, szEntryname))
-		if (hChild.OpenAsChild(&hGroup, szEntryname))
+		SubDefs.emplace_back(szEntryname);
+#ifdef C4ENGINE
+	const bool fParallel = Application.ThreadPool.GetThreadCount() > 1;
+#endif
+	int i = 0;
+	for (size_t iBatch = 0; iBatch < SubDefs.size(); iBatch += C4DefLoadBatchSize)
+	{
+		const size_t iBatchSize = std::min(C4DefLoadBatchSize, SubDefs.size() - iBatch);
+		std::vector<C4DefLoadStage> Stages;
+#ifdef C4ENGINE
+		// Read the files of a batch of sub definitions and decode them on all threads
+		// the definitions are loaded from the decoded data in their original order afterwards
+		// packed groups are kept in memory in between, so they are read and inflated only once
+		if (fParallel)
 		{
-			// Hack: Assume that there are sixteen sub definitions to avoid unnecessary I/O
-			int iSubMinProgress = std::min<int32_t>(iMaxProgress, iMinProgress + ((iMaxProgress - iMinProgress) * i) / 16);
-			int iSubMaxProgress = std::min<int32_t>(iMaxProgress, iMinProgress + ((iMaxProgress - iMinProgress) * (i + 1)) / 16);
-			++i;
-			iResult += Load(hChild, dwLoadWhat, szLanguage, pSoundSystem, fOverload, fSearchMessage, iSubMinProgress, iSubMaxProgress);
-			hChild.Close();
+			Stages = std::vector<C4DefLoadStage>(iBatchSize);
+			uint32_t tStart = timeGetTime();
+			for (size_t j = 0; j < iBatchSize; ++j)
+				if (OpenSubDef(hChild, hGroup, SubDefs[iBatch + j].c_str(), &Stages[j]))
+				{
+					Stages[j].Read(hChild, dwLoadWhat);
+					hChild.Close();
+				}
+			const uint32_t tRead = timeGetTime();
+			Application.ThreadPool.ParallelFor(iBatchSize, [&Stages](size_t j) { Stages[j].Decode(); });
+			StageReadTime += tRead - tStart;
+			StageDecodeTime += timeGetTime() - tRead;
 		}
+#endif
+		for (size_t j = 0; j < iBatchSize; ++j)
+			if (OpenSubDef(hChild, hGroup, SubDefs[iBatch + j].c_str(), Stages.empty() ? nullptr : &Stages[j]))
+			{
+				// Hack: Assume that there are sixteen sub definitions to avoid unnecessary I/O
+				int iSubMinProgress = std::min<int32_t>(iMaxProgress, iMinProgress + ((iMaxProgress - iMinProgress) * i) / 16);
+				int iSubMaxProgress = std::min<int32_t>(iMaxProgress, iMinProgress + ((iMaxProgress - iMinProgress) * (i + 1)) / 16);
+				++i;
+				iResult += Load(hChild, dwLoadWhat, szLanguage, pSoundSystem, fOverload, fSearchMessage, iSubMinProgress, iSubMaxProgress, true,
+					Stages.empty() ? nullptr : &Stages[j]);
+				hChild.Close();
+				if (!Stages.empty()) Stages[j].GroupImage.Clear();
+			}
+	}
 
 	// load additional system scripts for def groups only
 #ifdef C4ENGINE
@@ -1345,6 +1476,7 @@ void C4DefList::Default()
 {
 	FirstDef = nullptr;
 	LoadFailure = false;
+	StageReadTime = StageDecodeTime = 0;
 	std::fill(Table, std::end(Table), nullptr);
 	fTable = false;
 }
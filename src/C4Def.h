@@ -30,8 +30,14 @@
 #include <C4ScriptHost.h>
 #include <C4DefGraphics.h>
 #include "C4LangStringTable.h"
+#include <C4Log.h>
+#include <StdBitmap.h>
 #endif
 
+#include <memory>
+#include <string>
+#include <vector>
+
 const int32_t C4D_None                   = 0,
               C4D_All                    = ~C4D_None,
 
@@ -286,6 +292,7 @@ public:
 
 protected:
 	bool Compile(const char *szSource, const char *szName);
+	void Validate(C4Group &hGroup); // adjust and check values after compiling
 };
 
 class C4Def : public C4DefCore
@@ -343,7 +350,8 @@ public:
 	void Default();
 	bool Load(C4Group &hGroup,
 		uint32_t dwLoadWhat, const char *szLanguage,
-		class C4SoundSystem *pSoundSystem = nullptr);
+		class C4SoundSystem *pSoundSystem = nullptr,
+		class C4DefLoadStage *pStage = nullptr);
 	void Draw(C4Facet &cgo, bool fSelected = false, uint32_t iColor = 0, C4Object *pObj = nullptr, int32_t iPhaseX = 0, int32_t iPhaseY = 0);
 
 #ifdef C4ENGINE
@@ -374,6 +382,36 @@ public:
 	void ResetIncludeDependencies(); // resets all pointers into foreign definitions caused by include chains
 };
 
+#ifdef C4ENGINE
+
+// Files of a definition that are read ahead of C4Def::Load, so that they can be decoded on worker threads
+class C4DefLoadStage
+{
+public:
+	std::unique_ptr<C4Def> Def; // receives the DefCore; nullptr if the group was not staged
+	bool fDefCoreLoaded = false;
+	StdBuf GroupImage; // uncompressed contents of a packed definition group, so it is read from its mother only once
+
+	void Read(C4Group &hGroup, uint32_t dwLoadWhat); // main thread only
+	void Decode(); // compiles the DefCore and decodes images; may run on any thread
+	void LogMessages(); // log output of Decode
+	const StdBitmap *GetImage(const char *szFilename) const; // nullptr if not staged or not decodable
+
+private:
+	struct Image
+	{
+		std::string Filename;
+		StdBuf Data;
+		std::unique_ptr<StdBitmap> Bitmap;
+	};
+
+	StdStrBuf DefCoreSource;
+	StdCompilerMessages DefCoreMessages;
+	std::vector<Image> Images;
+};
+
+#endif
+
 class C4DefList
 #ifdef C4ENGINE
 	: public CStdFont::CustomImages
@@ -388,6 +426,7 @@ public:
 	C4Def **Table[64]; // From space to _; some minor waste of mem
 	bool fTable;
 	C4Def *FirstDef;
+	uint32_t StageReadTime, StageDecodeTime; // time in ms spent reading and decoding definitions ahead of loading
 
 public:
 	void Default();
@@ -396,7 +435,8 @@ public:
 		uint32_t dwLoadWhat, const char *szLanguage,
 		C4SoundSystem *pSoundSystem = nullptr,
 		bool fOverload = false,
-		bool fSearchMessage = false, int32_t iMinProgress = 0, int32_t iMaxProgress = 0, bool fLoadSysGroups = true);
+		bool fSearchMessage = false, int32_t iMinProgress = 0, int32_t iMaxProgress = 0, bool fLoadSysGroups = true,
+		class C4DefLoadStage *pStage = nullptr);
 	int32_t Load(const char *szSearch,
 		uint32_t dwLoadWhat, const char *szLanguage,
 		C4SoundSystem *pSoundSystem = nullptr,
@@ -425,6 +465,7 @@ public:
 
 private:
 	void SortByID(); // sorts list by quick access table
+	bool OpenSubDef(C4Group &hChild, C4Group &hGroup, const char *szEntryName, class C4DefLoadStage *pStage);
 };
 
 // Default Action Procedures
@@ -55,10 +55,16 @@ void C4DefGraphics::Clear()
 	pNext = nullptr; fColorBitmapAutoCreated = false;
 }
 
-bool C4DefGraphics::LoadBitmap(C4Group &hGroup, const char *szFilename, const char *szFilenamePNG, const char *szOverlayPNG, bool fColorByOwner)
+bool C4DefGraphics::LoadBitmap(C4Group &hGroup, const char *szFilename, const char *szFilenamePNG, const char *szOverlayPNG, bool fColorByOwner, const C4DefLoadStage *pStage)
 {
 	// try png
-	if (szFilenamePNG && hGroup.AccessEntry(szFilenamePNG))
+	const StdBitmap *pStaged = (pStage && szFilenamePNG) ? pStage->GetImage(szFilenamePNG) : nullptr;
+	if (pStaged)
+	{
+		Bitmap = new C4Surface();
+		if (!Bitmap->ReadBitmap(*pStaged)) return false;
+	}
+	else if (szFilenamePNG && hGroup.AccessEntry(szFilenamePNG))
 	{
 		Bitmap = new C4Surface();
 		if (!((C4Surface *)Bitmap)->ReadPNG(hGroup)) return false;
@@ -76,9 +82,10 @@ bool C4DefGraphics::LoadBitmap(C4Group &hGroup, const char *szFilename, const ch
 		// Create additionmal bitmap
 		BitmapClr = new C4Surface();
 		// if overlay-surface is present, load from that
-		if (szOverlayPNG && hGroup.AccessEntry(szOverlayPNG))
+		pStaged = (pStage && szOverlayPNG) ? pStage->GetImage(szOverlayPNG) : nullptr;
+		if (pStaged || (szOverlayPNG && hGroup.AccessEntry(szOverlayPNG)))
 		{
-			if (!BitmapClr->ReadPNG(hGroup))
+			if (!(pStaged ? BitmapClr->ReadBitmap(*pStaged) : BitmapClr->ReadPNG(hGroup)))
 				return false;
 			// set as Clr-surface, also checking size
 			if (!BitmapClr->SetAsClrByOwnerOf(Bitmap))
@@ -101,10 +108,10 @@ bool C4DefGraphics::LoadBitmap(C4Group &hGroup, const char *szFilename, const ch
 	return true;
 }
 
-bool C4DefGraphics::LoadBitmaps(C4Group &hGroup, bool fColorByOwner)
+bool C4DefGraphics::LoadBitmaps(C4Group &hGroup, bool fColorByOwner, const C4DefLoadStage *pStage)
 {
 	// load basic graphics
-	if (!LoadBitmap(hGroup, C4CFN_DefGraphics, C4CFN_DefGraphicsPNG, C4CFN_ClrByOwnerPNG, fColorByOwner)) return false;
+	if (!LoadBitmap(hGroup, C4CFN_DefGraphics, C4CFN_DefGraphicsPNG, C4CFN_ClrByOwnerPNG, fColorByOwner, pStage)) return false;
 	// load additional graphics
 	// first, search all png-graphics in NewGfx
 	char Filename[_MAX_PATH + 1]; *Filename = 0;
@@ -137,7 +144,7 @@ bool C4DefGraphics::LoadBitmaps(C4Group &hGroup, bool fColorByOwner)
 			EnforceExtension(OverlayFn, GetExtension(C4CFN_ClrByOwnerExPNG));
 		}
 		// load them
-		if (!pLastGraphics->LoadBitmap(hGroup, nullptr, Filename, fColorByOwner ? OverlayFn : nullptr, fColorByOwner))
+		if (!pLastGraphics->LoadBitmap(hGroup, nullptr, Filename, fColorByOwner ? OverlayFn : nullptr, fColorByOwner, pStage))
 			return false;
 	}
 	// load bitmap-graphics
@@ -197,7 +204,7 @@ bool C4DefGraphics::LoadBitmaps(C4Group &hGroup, bool fColorByOwner)
 		pLastGraphics->pNext = new C4PortraitGraphics(pDef, GrpName);
 		pLastGraphics = pLastGraphics->pNext;
 		// load them
-		if (!pLastGraphics->LoadBitmap(hGroup, fBMP ? Filename : nullptr, fBMP ? nullptr : Filename, *OverlayFn ? OverlayFn : nullptr, fColorByOwner))
+		if (!pLastGraphics->LoadBitmap(hGroup, fBMP ? Filename : nullptr, fBMP ? nullptr : Filename, *OverlayFn ? OverlayFn : nullptr, fColorByOwner, pStage))
 			return false;
 	}
 	// done, success
@@ -29,6 +29,7 @@
 // defintion graphics
 class C4AdditionalDefGraphics;
 class C4DefGraphicsPtrBackup;
+class C4DefLoadStage;
 class C4PortraitGraphics;
 
 class C4DefGraphics
@@ -48,8 +49,9 @@ public:
 	C4DefGraphics(C4Def *pOwnDef = nullptr);
 	virtual ~C4DefGraphics() { Clear(); };
 
-	bool LoadBitmap(C4Group &hGroup, const char *szFilename, const char *szFilenamePNG, const char *szOverlayPNG, bool fColorByOwner); // load specified graphics from group
-	bool LoadBitmaps(C4Group &hGroup, bool fColorByOwner); // load graphics from group
+	// load specified graphics from group, taking PNG images decoded ahead from pStage if present
+	bool LoadBitmap(C4Group &hGroup, const char *szFilename, const char *szFilenamePNG, const char *szOverlayPNG, bool fColorByOwner, const C4DefLoadStage *pStage = nullptr);
+	bool LoadBitmaps(C4Group &hGroup, bool fColorByOwner, const C4DefLoadStage *pStage = nullptr); // load graphics from group
 	bool ColorizeByMaterial(int32_t iMat, C4MaterialMap &rMats, uint8_t bGBM); // colorize all graphics by material
 	C4DefGraphics *Get(const char *szGrpName); // get graphics by name
 	void Clear(); // clear fields; delete additional graphics
@@ -567,12 +567,12 @@ int32_t FnFxFireStart(C4AulContext *ctx, C4Object *pObj, int32_t iNumber, int32_
 	{
 		// if object was blasted but not incinerated (i.e., inside extinguisher)
 		// do a script callback
-		if (fBlasted) pObj->Call(PSF_IncinerationEx, &C4AulParSet(C4VInt(iCausedBy)));
+		if (fBlasted) pObj->Call(OCB_IncinerationEx, &C4AulParSet(C4VInt(iCausedBy)));
 		return -1;
 	}
 	// determine fire appearance
 	int32_t iFireMode;
-	if (!(iFireMode = pObj->Call(PSF_FireMode).getInt()))
+	if (!(iFireMode = pObj->Call(OCB_FireMode).getInt()))
 	{
 		// set default fire modes
 		uint32_t dwCat = pObj->Category;
@@ -599,7 +599,7 @@ int32_t FnFxFireStart(C4AulContext *ctx, C4Object *pObj, int32_t iNumber, int32_
 	if (pObj->Shape.Wdt * pObj->Shape.Hgt > 500) StartSoundEffect("Inflame", false, 100, pObj);
 	if (pObj->Def->Mass >= 100) StartSoundEffect("Fire", true, 100, pObj);
 	// Engine script call
-	pObj->Call(PSF_Incineration, &C4AulParSet(C4VInt(iCausedBy)));
+	pObj->Call(OCB_Incineration, &C4AulParSet(C4VInt(iCausedBy)));
 	// Done, success
 	return C4Fx_OK;
 }
@@ -835,7 +835,7 @@ void Smoke(int32_t tx, int32_t ty, int32_t level, uint32_t dwClr)
 	level = BoundBy<int32_t>(level, 3, 32);
 	C4Object *pObj;
 	if (pObj = Game.CreateObjectConstruction(C4Id("FXS1"), nullptr, NO_OWNER, tx, ty, FullCon * level / 32))
-		pObj->Call(PSF_Activate);
+		pObj->Call(OCB_Activate);
 }
 
 void Explosion(int32_t tx, int32_t ty, int32_t level, C4Object *inobj, int32_t iCausedBy, C4Object *pByObj, C4ID idEffect, const char *szEffect)
@@ -873,7 +873,7 @@ void Explosion(int32_t tx, int32_t ty, int32_t level, C4Object *inobj, int32_t i
 				Game.Particles.Cast(Game.Particles.pFSpark, level / 5 + 1, (float)tx, (float)ty, level, level / 2 + 1.0f, 0x00ef0000, level + 1.0f, 0xffff1010);
 		}
 		else if (pBlast = Game.CreateObjectConstruction(idEffect ? idEffect : C4Id("FXB1"), pByObj, iCausedBy, tx, ty + level, FullCon * level / 20))
-			pBlast->Call(PSF_Activate);
+			pBlast->Call(OCB_Activate);
 	}
 	// Blast objects
 	Game.BlastObjects(tx, ty, level, inobj, iCausedBy, pByObj);
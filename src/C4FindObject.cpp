@@ -24,6 +24,8 @@
 
 // *** C4FindObject
 
+bool C4FindObject::UseIndexLists = true;
+
 C4FindObject::~C4FindObject()
 {
 	delete pSort;
@@ -231,8 +233,19 @@ int32_t C4FindObject::Count(const C4ObjectList &Objs, const C4LSectors &Sct)
 		return 0;
 	if (IsEnsured())
 		return Objs.ObjectCount();
-	// Check bounds
+	// Search an index list if it is more selective than the bounds
 	C4Rect *pBounds = GetBounds();
+	std::vector<C4Object *> Candidates;
+	if (GetIndexCandidates(Objs, pBounds, Candidates))
+	{
+		int32_t iCount = 0;
+		for (C4Object *pObj : Candidates)
+			if (pObj->Status)
+				if (Check(pObj))
+					iCount++;
+		return iCount;
+	}
+	// Check bounds
 	if (!pBounds)
 		return Count(Objs);
 	else if (UseShapes())
@@ -240,6 +253,9 @@ int32_t C4FindObject::Count(const C4ObjectList &Objs, const C4LSectors &Sct)
 		// Get area
 		C4LArea Area(&Game.Objects.Sectors, *pBounds); C4LSector *pSct;
 		C4ObjectList *pLst = Area.FirstObjectShapes(&pSct);
+		// No object shapes in the area?
+		if (!pLst)
+			return 0;
 		// Check if a single-sector check is enough
 		if (!Area.Next(pSct))
 			return Count(pSct->ObjectShapes);
@@ -274,8 +290,24 @@ C4Object *C4FindObject::Find(const C4ObjectList &Objs, const C4LSectors &Sct)
 	if (IsImpossible())
 		return nullptr;
 	C4Object *pBestResult = nullptr;
-	// Check bounds
+	// Search an index list if it is more selective than the bounds
 	C4Rect *pBounds = GetBounds();
+	std::vector<C4Object *> Candidates;
+	if (GetIndexCandidates(Objs, pBounds, Candidates))
+	{
+		for (C4Object *pObj : Candidates)
+			if (pObj->Status)
+				if (Check(pObj))
+					if (pObj->Status)
+					{
+						if (!pSort) return pObj;
+						if (!pBestResult || pSort->Compare(pObj, pBestResult) > 0)
+							if (pObj->Status)
+								pBestResult = pObj;
+					}
+		return pBestResult;
+	}
+	// Check bounds
 	if (!pBounds)
 		return Find(Objs);
 	// Traverse areas, return first matching object w/o sort or best with sort
@@ -312,16 +344,29 @@ C4ValueArray *C4FindObject::FindMany(const C4ObjectList &Objs, const C4LSectors
 	if (IsImpossible())
 		return new C4ValueArray();
 	C4Rect *pBounds = GetBounds();
-	if (!pBounds)
-		return FindMany(Objs);
 	// Prepare for array that may be generated
 	C4ValueArray *pArray; int32_t iSize;
+	// Search an index list if it is more selective than the bounds
+	std::vector<C4Object *> Candidates;
+	if (GetIndexCandidates(Objs, pBounds, Candidates))
+	{
+		pArray = new C4ValueArray(static_cast<int32_t>(Candidates.size())); iSize = 0;
+		for (C4Object *pObj : Candidates)
+			if (pObj->Status)
+				if (Check(pObj))
+					(*pArray)[iSize++] = C4VObj(pObj);
+	}
+	else if (!pBounds)
+		return FindMany(Objs);
 	// Check shape lists?
-	if (UseShapes())
+	else if (UseShapes())
 	{
 		// Get area
 		C4LArea Area(&Game.Objects.Sectors, *pBounds); C4LSector *pSct;
 		C4ObjectList *pLst = Area.FirstObjectShapes(&pSct);
+		// No object shapes in the area?
+		if (!pLst)
+			return new C4ValueArray();
 		// Check if a single-sector check is enough
 		if (!Area.Next(pSct))
 			return FindMany(pSct->ObjectShapes);
@@ -389,6 +434,61 @@ void C4FindObject::CheckObjectStatus(C4ValueArray *pArray)
 		}
 }
 
+bool C4FindObject::GetIndexCandidates(const C4ObjectList &Objs, C4Rect *pBounds, std::vector<C4Object *> &Candidates)
+{
+	// Indices are kept for the main object list only
+	if (!UseIndexLists || &Objs != &Game.Objects) return false;
+	C4ObjectIndexList *pIndex = GetIndexList();
+	if (!pIndex) return false;
+	// No bounds: The index list is always the better choice than the full list
+	if (!pBounds)
+	{
+		Candidates.reserve(pIndex->Count);
+		for (C4ObjectLink *pLnk = pIndex->Objects.First; pLnk; pLnk = pLnk->Next)
+			if (pLnk->Obj->Status)
+				Candidates.push_back(pLnk->Obj);
+		return true;
+	}
+	// Bounds: Use the index list if it holds fewer objects than the area is expected to
+	C4LSectors &Sectors = Game.Objects.Sectors;
+	C4LArea Area(&Sectors, *pBounds);
+	int32_t iAreaSectors = 0;
+	for (C4LSector *pSct = Area.First(); pSct; pSct = Area.Next(pSct))
+		iAreaSectors++;
+	const int64_t iAreaObjects = static_cast<int64_t>(Game.Objects.TypeIndex.GetObjectCount()) * iAreaSectors / (Sectors.Size + 1);
+	if (pIndex->Count >= iAreaObjects) return false;
+	// Keep the objects the area search would find, in the order it would find them:
+	// by the first sector of the area the object is listed in, then in list order
+	const bool fUseShapes = UseShapes();
+	std::vector<std::pair<int32_t, C4Object *>> SectorCandidates;
+	for (C4ObjectLink *pLnk = pIndex->Objects.First; pLnk; pLnk = pLnk->Next)
+	{
+		C4Object *pObj = pLnk->Obj;
+		// objects are not in any sector before their first position update
+		if (!pObj->Status || pObj->Area.IsNull()) continue;
+		C4LSector *pSct;
+		if (fUseShapes)
+		{
+			for (pSct = pObj->Area.First(); pSct; pSct = pObj->Area.Next(pSct))
+				if (Area.Contains(pSct))
+					break;
+		}
+		else
+		{
+			pSct = Sectors.SectorAt(pObj->old_x, pObj->old_y);
+			if (!Area.Contains(pSct)) pSct = nullptr;
+		}
+		if (pSct)
+			SectorCandidates.emplace_back(pSct == &Sectors.SectorOut ? Sectors.Size : static_cast<int32_t>(pSct - Sectors.Sectors), pObj);
+	}
+	std::stable_sort(SectorCandidates.begin(), SectorCandidates.end(),
+		[](const std::pair<int32_t, C4Object *> &a, const std::pair<int32_t, C4Object *> &b) { return a.first < b.first; });
+	Candidates.reserve(SectorCandidates.size());
+	for (const auto &Candidate : SectorCandidates)
+		Candidates.push_back(Candidate.second);
+	return true;
+}
+
 void C4FindObject::SetSort(C4SortObject *pToSort)
 {
 	delete pSort;
@@ -466,6 +566,19 @@ bool C4FindObjectAnd::Check(C4Object *pObj)
 	return true;
 }
 
+C4ObjectIndexList *C4FindObjectAnd::GetIndexList()
+{
+	// the smallest index list of all conditions
+	C4ObjectIndexList *pBestList = nullptr;
+	for (int32_t i = 0; i < iCnt; i++)
+	{
+		C4ObjectIndexList *pList = ppConds[i]->GetIndexList();
+		if (pList && (!pBestList || pList->Count < pBestList->Count))
+			pBestList = pList;
+	}
+	return pBestList;
+}
+
 bool C4FindObjectAnd::IsImpossible()
 {
 	for (int32_t i = 0; i < iCnt; i++)
@@ -554,6 +667,13 @@ bool C4FindObjectID::IsImpossible()
 	return !pDef || !pDef->Count;
 }
 
+C4ObjectIndexList *C4FindObjectID::GetIndexList()
+{
+	static C4ObjectIndexList EmptyList;
+	C4ObjectIndexList *pList = Game.Objects.TypeIndex.GetIDList(id);
+	return pList ? pList : &EmptyList;
+}
+
 bool C4FindObjectInRect::Check(C4Object *pObj)
 {
 	return rect.Contains(pObj->x, pObj->y);
@@ -606,6 +726,11 @@ bool C4FindObjectCategory::IsEnsured()
 	return !iCategory;
 }
 
+C4ObjectIndexList *C4FindObjectCategory::GetIndexList()
+{
+	return Game.Objects.TypeIndex.GetCategoryList(iCategory);
+}
+
 bool C4FindObjectAction::Check(C4Object *pObj)
 {
 	return SEqual(pObj->Action.Name, szAction);
@@ -21,6 +21,10 @@
 #include "C4Value.h"
 #include "C4Aul.h"
 
+#include <vector>
+
+struct C4ObjectIndexList;
+
 // Condition map
 enum C4FindObjectCondID
 {
@@ -86,6 +90,8 @@ public:
 
 	void SetSort(C4SortObject *pToSort);
 
+	static bool UseIndexLists; // plan queries with the id and category indices; only disabled to measure their gain
+
 protected:
 	// Overridables
 	virtual bool Check(C4Object *pObj) = 0;
@@ -93,9 +99,11 @@ protected:
 	virtual bool UseShapes() { return false; }
 	virtual bool IsImpossible() { return false; }
 	virtual bool IsEnsured() { return false; }
+	virtual C4ObjectIndexList *GetIndexList() { return nullptr; } // index list containing all objects that may fulfill the condition
 
 private:
 	void CheckObjectStatus(C4ValueArray *pArray);
+	bool GetIndexCandidates(const C4ObjectList &Objs, C4Rect *pBounds, std::vector<C4Object *> &Candidates); // query planner
 };
 
 // Combinators
@@ -132,6 +140,7 @@ protected:
 	virtual bool UseShapes() { return fUseShapes; }
 	virtual bool IsEnsured() { return !iCnt; }
 	virtual bool IsImpossible();
+	virtual C4ObjectIndexList *GetIndexList();
 };
 
 class C4FindObjectOr : public C4FindObject
@@ -178,6 +187,7 @@ private:
 protected:
 	virtual bool Check(C4Object *pObj);
 	virtual bool IsImpossible();
+	virtual C4ObjectIndexList *GetIndexList();
 };
 
 class C4FindObjectInRect : public C4FindObject
@@ -285,6 +295,7 @@ private:
 protected:
 	virtual bool Check(C4Object *pObj);
 	virtual bool IsEnsured();
+	virtual C4ObjectIndexList *GetIndexList();
 };
 
 class C4FindObjectAction : public C4FindObject
@@ -35,7 +35,7 @@
 #include <C4Startup.h>
 #include <C4Viewport.h>
 #include <C4Command.h>
-#include <C4Stat.h>
+#include <C4Profiler.h>
 #include <C4PlayerInfo.h>
 #include <C4LoaderScreen.h>
 #include <C4Network2Dialogs.h>
@@ -77,6 +77,8 @@ bool C4Game::InitDefs()
 {
 	int32_t iDefs = 0;
 	Log(LoadResStr("IDS_PRC_INITDEFS"));
+	const uint32_t tStart = timeGetTime();
+	Defs.StageReadTime = Defs.StageDecodeTime = 0;
 	int iDefResCount = 0;
 	C4GameRes *pDef;
 	for (pDef = Parameters.GameRes.iterRes(nullptr, NRT_Definitions); pDef; pDef = Parameters.GameRes.iterRes(pDef, NRT_Definitions))
@@ -100,6 +102,10 @@ bool C4Game::InitDefs()
 	// Absolutely no defs: we don't like that
 	if (!iDefs) { LogFatal(LoadResStr("IDS_PRC_NODEFS")); return false; }
 
+	const uint32_t tLoad = timeGetTime() - tStart;
+	LogSilentF("%d definitions loaded in %u ms (read ahead %u ms, decode %u ms, register %u ms)", iDefs, tLoad,
+		Defs.StageReadTime, Defs.StageDecodeTime, tLoad - Defs.StageReadTime - Defs.StageDecodeTime);
+
 	// Check def engine version (should be done immediately on def load)
 	iDefs = Defs.CheckEngineVersion(C4XVER1, C4XVER2, C4XVER3, C4XVER4);
 	if (iDefs > 0) { LogF(LoadResStr("IDS_PRC_DEFSINVC4X"), iDefs); }
@@ -505,6 +511,7 @@ bool C4Game::Init()
 
 	// Start message
 	Log(LoadResStr(C4S.Head.NetworkGame ? "IDS_PRC_JOIN" : C4S.Head.SaveGame ? "IDS_PRC_RESUME" : "IDS_PRC_START"));
+	LogSilentF("Inflated %zu bytes from packed groups", StdGzCompressedFile::Read::InflatedBytes.load());
 
 	// set non-exclusive GUI
 	if (pGUI)
@@ -531,7 +538,16 @@ void C4Game::Clear()
 	IsRunning = false;
 	PointersDenumerated = false;
 
-	C4ST_SHOWSTAT
+	// write profiler trace requested by command line
+	if (ProfilerTraceFile.getLength())
+	{
+		C4Profiler::Enable(false);
+		if (C4Profiler::ExportTrace(ProfilerTraceFile.getData()))
+			LogF("Profiler trace written to %s", ProfilerTraceFile.getData());
+		else
+			LogF("Could not write profiler trace to %s", ProfilerTraceFile.getData());
+		C4Profiler::Clear();
+	}
 
 	// Evaluation
 	if (GameOver)
@@ -579,6 +595,7 @@ void C4Game::Clear()
 	GameText.Clear();
 	RecordDumpFile.Clear();
 	RecordStream.Clear();
+	ProfilerTraceFile.Clear();
 
 	PathFinder.Clear();
 	TransferZones.Clear();
@@ -714,33 +731,22 @@ bool C4Game::GameOverCheck()
 int32_t iLastControlSize = 0;
 extern int32_t iPacketDelay;
 
-C4ST_NEW(ControlRcvStat,  "C4Game::Execute ReceiveControl")
-C4ST_NEW(ControlStat,     "C4Game::Execute ExecuteControl")
-C4ST_NEW(ExecObjectsStat, "C4Game::Execute ExecObjects")
-C4ST_NEW(GEStats,         "C4Game::Execute pGlobalEffects->Execute")
-C4ST_NEW(PXSStat,         "C4Game::Execute PXS.Execute")
-C4ST_NEW(PartStat,        "C4Game::Execute Particles.Execute")
-C4ST_NEW(MassMoverStat,   "C4Game::Execute MassMover.Execute")
-C4ST_NEW(WeatherStat,     "C4Game::Execute Weather.Execute")
-C4ST_NEW(PlayersStat,     "C4Game::Execute Players.Execute")
-C4ST_NEW(LandscapeStat,   "C4Game::Execute Landscape.Execute")
-C4ST_NEW(MusicSystemStat, "C4Game::Execute MusicSystem.Execute")
-C4ST_NEW(MessagesStat,    "C4Game::Execute Messages.Execute")
-C4ST_NEW(ScriptStat,      "C4Game::Execute Script.Execute")
-
-#define EXEC_S(Expressions, Stat) \
-	{ C4ST_START(Stat) Expressions C4ST_STOP(Stat) }
+// profiles the expressions as a zone of the frame
+#define EXEC_S(Expressions, ZoneName) \
+	{ C4ProfilerScope ProfilerScope(ZoneName); Expressions }
 
 #ifdef DEBUGREC
-#define EXEC_S_DR(Expressions, Stat, DebugRecName) { AddDbgRec(RCT_Block, DebugRecName, 6); EXEC_S(Expressions, Stat) }
+#define EXEC_S_DR(Expressions, ZoneName, DebugRecName) { AddDbgRec(RCT_Block, DebugRecName, 6); EXEC_S(Expressions, ZoneName) }
 #define EXEC_DR(Expressions, DebugRecName) { AddDbgRec(RCT_Block, DebugRecName, 6); Expressions }
 #else
-#define EXEC_S_DR(Expressions, Stat, DebugRecName) EXEC_S(Expressions, Stat)
+#define EXEC_S_DR(Expressions, ZoneName, DebugRecName) EXEC_S(Expressions, ZoneName)
 #define EXEC_DR(Expressions, DebugRecName) Expressions
 #endif
 
 bool C4Game::Execute() // Returns true if the game is over
 {
+	C4ProfilerScope FrameProfilerScope("C4Game::Execute");
+
 	// Let's go
 	GameGo = true;
 
@@ -749,7 +755,7 @@ bool C4Game::Execute() // Returns true if the game is over
 
 	// Prepare control
 	bool fControl;
-	EXEC_S(fControl = Control.Prepare();, ControlStat)
+	EXEC_S(fControl = Control.Prepare();, "C4Game::Execute Control.Prepare")
 	if (!fControl) return false; // not ready yet: wait
 
 	// Halt
@@ -773,19 +779,19 @@ bool C4Game::Execute() // Returns true if the game is over
 
 	// Game
 
-	EXEC_S(ExecObjects();, ExecObjectsStat)
+	EXEC_S(ExecObjects();, "C4Game::Execute ExecObjects")
 	if (pGlobalEffects)
-		EXEC_S_DR(pGlobalEffects->Execute(nullptr);, GEStats, "GEEx\0");
-	EXEC_S_DR(PXS.Execute();,                     PXSStat,         "PXSEx")
-	EXEC_S_DR(Particles.GlobalParticles.Exec();,  PartStat,        "ParEx")
-	EXEC_S_DR(MassMover.Execute();,               MassMoverStat,   "MMvEx")
-	EXEC_S_DR(Weather.Execute();,                 WeatherStat,     "WtrEx")
-	EXEC_S_DR(Landscape.Execute();,               LandscapeStat,   "LdsEx")
-	EXEC_S_DR(Players.Execute();,                 PlayersStat,     "PlrEx")
+		EXEC_S_DR(pGlobalEffects->Execute(nullptr);, "C4Game::Execute pGlobalEffects->Execute", "GEEx\0");
+	EXEC_S_DR(PXS.Execute();,                     "C4Game::Execute PXS.Execute",                 "PXSEx")
+	EXEC_S_DR(Particles.GlobalParticles.Exec();,  "C4Game::Execute Particles.Execute",           "ParEx")
+	EXEC_S_DR(MassMover.Execute();,               "C4Game::Execute MassMover.Execute",           "MMvEx")
+	EXEC_S_DR(Weather.Execute();,                 "C4Game::Execute Weather.Execute",             "WtrEx")
+	EXEC_S_DR(Landscape.Execute();,               "C4Game::Execute Landscape.Execute",           "LdsEx")
+	EXEC_S_DR(Players.Execute();,                 "C4Game::Execute Players.Execute",             "PlrEx")
 	// FIXME: C4Application::Execute should do this, but what about the stats?
-	EXEC_S_DR(Application.MusicSystem.Execute();, MusicSystemStat, "Music")
-	EXEC_S_DR(Messages.Execute();,                MessagesStat,    "MsgEx")
-	EXEC_S_DR(Script.Execute();,                  ScriptStat,      "Scrpt")
+	EXEC_S_DR(Application.MusicSystem.Execute();, "C4Game::Execute MusicSystem.Execute",         "Music")
+	EXEC_S_DR(Messages.Execute();,                "C4Game::Execute Messages.Execute",            "MsgEx")
+	EXEC_S_DR(Script.Execute();,                  "C4Game::Execute Script.Execute",              "Scrpt")
 
 	EXEC_DR(MouseControl.Execute();, "Input")
 
@@ -801,13 +807,6 @@ bool C4Game::Execute() // Returns true if the game is over
 		if (!GameOverDlgShown) ShowGameOverDlg();
 	}
 
-	// show stat each 1000 ticks
-	if (!(FrameCounter % 1000))
-	{
-		C4ST_SHOWPARTSTAT
-		C4ST_RESETPART
-	}
-
 #ifdef DEBUGREC
 	AddDbgRec(RCT_Block, "eGame", 6);
 
@@ -1065,7 +1064,7 @@ C4Object *C4Game::NewObject(C4Def *pDef, C4Object *pCreator,
 	// ---- From now on, object is ready to be used in scripts!
 	// Construction callback
 	C4AulParSet pars(C4VObj(pCreator));
-	pObj->Call(PSF_Construction, &pars);
+	pObj->Call(OCB_Construction, &pars);
 	// AssignRemoval called? (Con 0)
 	if (!pObj->Status) { return nullptr; }
 	// Do initial con
@@ -2342,7 +2341,7 @@ bool C4Game::InitGame(C4Group &hGroup, C4ScenarioSection *section, bool fLoadSky
 		Landscape.ScenarioInit();
 	SetInitProgress(89);
 	// Init main object list
-	Objects.Init(Landscape.Width, Landscape.Height);
+	Objects.Init(Landscape.Width, Landscape.Height, C4S.Landscape.SectorSize);
 
 	// Pathfinder
 	if (!section) PathFinder.Init(&LandscapeFree, &TransferZones);
@@ -2943,6 +2942,15 @@ void C4Game::ParseCommandLine(const char *szCmdLine)
 		// record stream
 		if (SEqual2NoCase(szParameter, "/stream:"))
 			RecordStream.Copy(szParameter + 8);
+		// profiler trace
+		if (SEqual2NoCase(szParameter, "/trace:"))
+		{
+			ProfilerTraceFile.Copy(szParameter + 7);
+			C4Profiler::Enable(true);
+		}
+		// benchmarks
+		if (SEqual2NoCase(szParameter, "/benchmark:"))
+			Application.Benchmark.Copy(szParameter + 11);
 		// startup start screen
 		if (SEqual2NoCase(szParameter, "/startup:"))
 			C4Startup::SetStartScreen(szParameter + 9);
@@ -157,6 +157,7 @@ public:
 	bool Verbose; // default false; set to true only by command line
 	StdStrBuf RecordDumpFile;
 	StdStrBuf RecordStream;
+	StdStrBuf ProfilerTraceFile; // trace of the whole round is written there
 	bool TempScenarioFile;
 	bool fPreinited; // set after PreInit has been called; unset by Clear and Default
 	int32_t FrameCounter;
@@ -288,8 +289,6 @@ protected:
 	void InitEnvironment();
 	void UpdateRules();
 	void CloseScenario();
-	void DeleteObjects(bool fDeleteInactive);
-	void ExecObjects();
 	void Ticks();
 	std::vector<std::string> FoldersWithLocalsDefs(std::string path);
 	bool CheckObjectEnumeration();
@@ -299,6 +298,9 @@ protected:
 
 public:
 	bool SaveGameTitle(C4Group &hGroup);
+	bool EnumerateMaterials(); // look up the system materials after loading materials
+	void DeleteObjects(bool fDeleteInactive);
+	void ExecObjects();
 
 protected:
 	bool InitGame(C4Group &hGroup, C4ScenarioSection *section, bool fLoadSky);
@@ -313,7 +315,6 @@ protected:
 	bool OpenScenario();
 	bool InitDefs();
 	bool InitMaterialTexture();
-	bool EnumerateMaterials();
 	bool GameOverCheck();
 	bool PlaceInEarth(C4ID id);
 	bool Compile(const char *szSource);
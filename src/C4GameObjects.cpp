@@ -31,6 +31,9 @@
 C4GameObjects::C4GameObjects()
 {
 	Default();
+	// objects are frequently looked up by number (scripts, denumeration, network controls)
+	EnableNumberIndex();
+	InactiveObjects.EnableNumberIndex();
 }
 
 C4GameObjects::~C4GameObjects()
@@ -42,13 +45,14 @@ void C4GameObjects::Default()
 {
 	ResortProc = nullptr;
 	Sectors.Clear();
+	TypeIndex.Clear();
 	LastUsedMarker = 0;
 }
 
-void C4GameObjects::Init(int32_t iWidth, int32_t iHeight)
+void C4GameObjects::Init(int32_t iWidth, int32_t iHeight, int32_t iSectorSize)
 {
 	// init sectors
-	Sectors.Init(iWidth, iHeight);
+	Sectors.Init(iWidth, iHeight, iSectorSize);
 }
 
 bool C4GameObjects::Add(C4Object *nObj)
@@ -67,6 +71,8 @@ bool C4GameObjects::Add(C4Object *nObj)
 		return false;
 	// add to sectors
 	Sectors.Add(nObj, this);
+	// add to search indices
+	TypeIndex.Add(nObj, this);
 	return true;
 }
 
@@ -76,6 +82,8 @@ bool C4GameObjects::Remove(C4Object *pObj)
 	if (pObj->Status == C4OS_INACTIVE) return InactiveObjects.Remove(pObj);
 	// remove from sectors
 	Sectors.Remove(pObj);
+	// remove from search indices
+	TypeIndex.Remove(pObj);
 	// remove from backlist
 	Game.BackObjects.Remove(pObj);
 	// remove from forelist
@@ -130,8 +138,8 @@ void C4GameObjects::CrossCheck() // Every Tick1 by ExecObjects
 								// RejectFight callback
 								C4AulParSet parset1(C4VObj(obj2));
 								C4AulParSet parset2(C4VObj(obj1));
-								if (obj1->Call(PSF_RejectFight, &parset1).getBool()) continue;
-								if (obj2->Call(PSF_RejectFight, &parset2).getBool()) continue;
+								if (obj1->Call(OCB_RejectFight, &parset1).getBool()) continue;
+								if (obj2->Call(OCB_RejectFight, &parset2).getBool()) continue;
 								ObjectActionFight(obj1, obj2);
 								ObjectActionFight(obj2, obj1);
 								continue;
@@ -167,7 +175,7 @@ void C4GameObjects::CrossCheck() // Every Tick1 by ExecObjects
 										obj2->Marker = Marker;
 										// Hit
 										if ((obj2->OCF & OCF_HitSpeed2) && (obj1->OCF & OCF_Alive) && (obj2->Category & C4D_Object))
-											if (!obj1->Call(PSF_QueryCatchBlow, &C4AulParSet(C4VObj(obj2))))
+											if (!obj1->Call(OCB_QueryCatchBlow, &C4AulParSet(C4VObj(obj2))))
 											{
 												// "realistic" hit energy
 												FIXED dXDir = obj2->xdir - obj1->xdir, dYDir = obj2->ydir - obj1->ydir;
@@ -177,7 +185,7 @@ void C4GameObjects::CrossCheck() // Every Tick1 by ExecObjects
 												int tmass = std::max<int32_t>(obj1->Mass, 50);
 												if (!Tick3 || (obj1->Action.Act >= 0 && obj1->Def->ActMap[obj1->Action.Act].Procedure != DFA_FLIGHT))
 													obj1->Fling(obj2->xdir * 50 / tmass, -Abs(obj2->ydir / 2) * 50 / tmass, false, obj2->Controller);
-												obj1->Call(PSF_CatchBlow, &C4AulParSet(C4VInt(-iHitEnergy / 5),
+												obj1->Call(OCB_CatchBlow, &C4AulParSet(C4VInt(-iHitEnergy / 5),
 													C4VObj(obj2)));
 												// obj1 might have been tampered with
 												if (!obj1->Status || obj1->Contained || !(obj1->OCF & focf))
@@ -502,6 +510,7 @@ void C4ObjResort::Sort(C4ObjectLink *pFirst, C4ObjectLink *pLast)
 				// so there's something to be reordered: swap the links
 				// FIXME: Inform C4ObjectList about this reorder
 				C4Object *pObj = pCurr->Obj; pCurr->Obj = pCurr2->Obj; pCurr2->Obj = pObj;
+				Game.Objects.UpdateLink(pCurr); Game.Objects.UpdateLink(pCurr2);
 				// and readd to sector lists
 				pCurr->Obj->Unsorted = pCurr2->Obj->Unsorted = true;
 				// grow list section to scan next
@@ -557,8 +566,7 @@ int C4GameObjects::Load(C4Group &hGroup, bool fKeepInactive)
 		// check object number collision with inactive list
 		if (fKeepInactive)
 		{
-			for (C4ObjectLink *clnk = InactiveObjects.First; clnk; clnk = clnk->Next)
-				if (clnk->Obj->Number == pObj->Number) fObjectNumberCollision = true;
+			if (InactiveObjects.ObjectPointer(pObj->Number)) fObjectNumberCollision = true;
 		}
 		// keep track of numbers
 		iMaxObjectNumber = std::max<long>(iMaxObjectNumber, pObj->Number);
@@ -575,7 +583,12 @@ int C4GameObjects::Load(C4Group &hGroup, bool fKeepInactive)
 	// if object numbers collideded, numbers will be adjusted afterwards
 	// so fake inactive object list empty meanwhile
 	C4ObjectLink *pInFirst;
-	if (fObjectNumberCollision) { pInFirst = InactiveObjects.First; InactiveObjects.First = nullptr; }
+	std::unique_ptr<C4ObjectNumberIndex> pInNumberIndex;
+	if (fObjectNumberCollision)
+	{
+		pInFirst = InactiveObjects.First; InactiveObjects.First = nullptr;
+		pInNumberIndex = std::move(InactiveObjects.pNumberIndex);
+	}
 	// denumerate pointers
 	Denumerate();
 	// update object enumeration index now, because calls like UpdateTransferZone might create objects
@@ -584,10 +597,12 @@ int C4GameObjects::Load(C4Group &hGroup, bool fKeepInactive)
 	if (fObjectNumberCollision)
 	{
 		InactiveObjects.First = pInFirst;
+		InactiveObjects.pNumberIndex = std::move(pInNumberIndex);
 		// simply renumber all inactive objects
 		for (cLnk = InactiveObjects.First; cLnk; cLnk = cLnk->Next)
 			if ((pObj = cLnk->Obj)->Status)
 				pObj->Number = ++Game.ObjectEnumerationIndex;
+		InactiveObjects.UpdateNumberIndex();
 	}
 
 	// special checks:
@@ -647,6 +662,9 @@ int C4GameObjects::Load(C4Group &hGroup, bool fKeepInactive)
 			Mass -= pObj->Mass;
 		}
 	}
+	UpdateNumberIndex();
+	InactiveObjects.UpdateNumberIndex();
+	UpdateTypeIndex();
 
 	{
 		C4DebugRecOff DBGRECOFF; // - script callbacks that would kill DebugRec-sync for runtime start
@@ -661,6 +679,8 @@ int C4GameObjects::Load(C4Group &hGroup, bool fKeepInactive)
 	// make sure list is sorted by category - after sorting out inactives, because inactives aren't sorted into the main list
 	FixObjectOrder();
 
+	UpdateTypeIndex();
+
 	// misc updates
 	for (cLnk = First; cLnk; cLnk = cLnk->Next)
 		if ((pObj = cLnk->Obj)->Status)
@@ -734,11 +754,22 @@ void C4GameObjects::UpdatePos(C4Object *pObj)
 	Sectors.Update(pObj, this);
 }
 
+void C4GameObjects::UpdateTypeIndex()
+{
+	// rebuild search indices after the main list was manipulated directly
+	TypeIndex.Clear();
+	for (C4ObjectLink *cLnk = First; cLnk; cLnk = cLnk->Next)
+		if (cLnk->Obj->Status)
+			TypeIndex.Add(cLnk->Obj, this);
+}
+
 void C4GameObjects::UpdatePosResort(C4Object *pObj)
 {
-	// Object order for this object was changed. Readd object to sectors
+	// Object order for this object was changed. Readd object to sectors and search indices
 	Sectors.Remove(pObj);
 	Sectors.Add(pObj, this);
+	TypeIndex.Remove(pObj);
+	TypeIndex.Add(pObj, this);
 }
 
 bool C4GameObjects::OrderObjectBefore(C4Object *pObj1, C4Object *pObj2)
@@ -812,6 +843,7 @@ void C4GameObjects::FixObjectOrder()
 				}
 				pLnk->Obj = pLnkPrev->Obj;
 				pLnkPrev->Obj = pObj;
+				UpdateLink(pLnk); UpdateLink(pLnkPrev);
 				pLnkLastUnsorted = pLnkPrev;
 			}
 			else
@@ -837,6 +869,7 @@ void C4GameObjects::FixObjectOrder()
 				}
 				pLnk->Obj = pLnkPrev->Obj;
 				pLnkPrev->Obj = pObj;
+				UpdateLink(pLnk); UpdateLink(pLnkPrev);
 				pLnk1stUnsorted = pLnkPrev;
 			}
 			else
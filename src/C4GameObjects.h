@@ -32,7 +32,7 @@ public:
 	C4GameObjects();
 	~C4GameObjects();
 	void Default();
-	void Init(int32_t iWidth, int32_t iHeight);
+	void Init(int32_t iWidth, int32_t iHeight, int32_t iSectorSize = 0);
 	void Clear(bool fClearInactive = true); // clear objects
 
 private:
@@ -40,6 +40,7 @@ private:
 
 public:
 	C4LSectors Sectors; // section object lists
+	C4ObjectTypeIndex TypeIndex; // objects by id and category for FindObject
 	C4ObjectList InactiveObjects; // inactive objects (Status=2)
 	C4ObjResort *ResortProc; // current sheduled user resorts
 
@@ -70,6 +71,8 @@ public:
 
 	void UpdatePos(C4Object *pObj);
 	void UpdatePosResort(C4Object *pObj);
+	void UpdateTypeIndex(C4Object *pObj) { TypeIndex.Update(pObj, this); } // after id or category change
+	void UpdateTypeIndex(); // rebuild search indices after the main list was manipulated directly
 
 	bool OrderObjectBefore(C4Object *pObj1, C4Object *pObj2); // order pObj1 before pObj2
 	bool OrderObjectAfter(C4Object *pObj1, C4Object *pObj2); // order pObj1 after pObj2
@@ -31,6 +31,7 @@
 #include <C4Player.h>
 #include <C4Object.h>
 #include <C4SoundSystem.h>
+#include <C4Profiler.h>
 
 #include <StdBitmap.h>
 #include <StdPNG.h>
@@ -149,6 +150,14 @@ void C4GraphicsSystem::Execute()
 	// activity check
 	if (!StartDrawing()) return;
 
+	// texture uploads since the last drawn frame
+	if (pTexMgr)
+	{
+		C4Profiler::Counter("Texture upload bytes", pTexMgr->iUploadedBytes);
+		C4Profiler::Counter("Texture uploads", pTexMgr->iUploadCount);
+		pTexMgr->ResetUploadStats();
+	}
+
 	bool fBGDrawn = false;
 
 	// If lobby running, message board only (page flip done by startup message board)
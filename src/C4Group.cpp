@@ -39,7 +39,13 @@
 #include <StdSha1.h>
 #include <fcntl.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <ctime>
+#include <string>
+#include <thread>
+#include <vector>
 
 // File Sort Lists
 
@@ -78,6 +84,8 @@ int iC4GroupRewindFilePtrNoWarn = 0;
 char C4Group_Maker[C4GroupMaxMaker + 1] = "";
 char C4Group_Passwords[CFG_MaxString + 1] = "";
 char C4Group_TempPath[_MAX_PATH + 1] = "";
+char C4Group_CachePath[_MAX_PATH + 1] = "";
+uint64_t C4Group_CacheMaxSize = 0;
 char C4Group_Ignore[_MAX_PATH + 1] = "cvs;Thumbs.db";
 const char **C4Group_SortList = nullptr;
 time_t C4Group_AssumeTimeOffset = 0;
@@ -110,6 +118,166 @@ const char *C4Group_GetTempPath()
 	return C4Group_TempPath;
 }
 
+void C4Group_SetCompressionThreads(int iThreads)
+{
+	if (iThreads <= 0) iThreads = static_cast<int>(std::thread::hardware_concurrency());
+	StdGzCompressedFile::Write::ThreadCount = (std::max)(iThreads, 1);
+}
+
+// Group cache images: the inflated contents of a packed group file behind a header padded
+// to a page, so they can be mapped and read without decompression.
+
+#define C4GroupCacheID "C4GrpCache1"
+
+const size_t C4GroupCacheDataOffset = 4096,
+             C4GroupCacheMinSize = 64 * 1024; // smaller groups are not worth an image
+
+const int C4GroupCacheTempTimeout = 24 * 60 * 60; // temporary files of other processes are considered stale after this many seconds
+
+struct C4GroupCacheHeader
+{
+	char id[sizeof(C4GroupCacheID)];
+	uint64_t SourceSize;
+	int64_t SourceTime;
+	uint64_t DataSize;
+};
+
+static bool C4Group_CheckCacheImage(const char *szImage, const C4GroupCacheHeader &Expected)
+{
+	FILE *hFile = fopen(szImage, "rb");
+	if (!hFile) return false;
+	C4GroupCacheHeader Head;
+	const bool fRead = fread(&Head, sizeof(Head), 1, hFile) == 1;
+	fclose(hFile);
+	return fRead && SEqual(Head.id, C4GroupCacheID)
+		&& Head.SourceSize == Expected.SourceSize && Head.SourceTime == Expected.SourceTime
+		&& FileSize(szImage) == C4GroupCacheDataOffset + Head.DataSize;
+}
+
+static bool C4Group_WriteCacheImage(const char *szFilename, const char *szImage, C4GroupCacheHeader Head)
+{
+	// write to temporary file first, so no incomplete image is ever opened
+	// it is unique for every process and write, so concurrent writers of the same image do not clash
+	static std::atomic<unsigned int> iTempCounter{0};
+#ifdef _WIN32
+	const unsigned long iProcessID = GetCurrentProcessId();
+#else
+	const unsigned long iProcessID = static_cast<unsigned long>(getpid());
+#endif
+	const StdStrBuf Temp = FormatString("%s.%lu-%u.tmp", szImage, iProcessID, ++iTempCounter);
+	FILE *hFile = fopen(Temp.getData(), "wb");
+	if (!hFile) return false;
+	bool fSuccess = false;
+	try
+	{
+		StdGzCompressedFile::Read Source{szFilename};
+		std::unique_ptr<uint8_t[]> Buffer{new uint8_t[StdGzCompressedFile::ChunkSize]};
+		Head.DataSize = 0;
+		fSuccess = !fseek(hFile, C4GroupCacheDataOffset, SEEK_SET);
+		while (fSuccess)
+		{
+			const size_t iRead = Source.ReadData(Buffer.get(), StdGzCompressedFile::ChunkSize);
+			if (!iRead) break;
+			fSuccess = fwrite(Buffer.get(), 1, iRead, hFile) == iRead;
+			Head.DataSize += iRead;
+		}
+	}
+	catch (const StdGzCompressedFile::Exception &)
+	{
+		fSuccess = false;
+	}
+	// header last
+	fSuccess = fSuccess && !fseek(hFile, 0, SEEK_SET) && fwrite(&Head, sizeof(Head), 1, hFile) == 1;
+	if (fclose(hFile)) fSuccess = false;
+	if (fSuccess)
+	{
+		EraseFile(szImage);
+		fSuccess = RenameFile(Temp.getData(), szImage);
+	}
+	if (!fSuccess) EraseFile(Temp.getData());
+	return fSuccess;
+}
+
+// Remove least recently used images until the cache fits its size limit
+// Opening an image updates its modification time, which is used as its last use
+static void C4Group_TrimCache(const char *szKeep = nullptr)
+{
+	struct CacheFile
+	{
+		std::string Filename;
+		uint64_t Size;
+		int Time;
+	};
+	std::vector<CacheFile> Images;
+	uint64_t iTotalSize = 0;
+	const int iNow = static_cast<int>(time(nullptr));
+	for (DirectoryIterator it(C4Group_CachePath); *it; ++it)
+	{
+		const CacheFile File{*it, FileSize(*it), FileTime(*it)};
+		// temporary files of images that are being written; remove those left behind by crashed processes
+		if (SEqualNoCase(GetExtension(*it), "tmp"))
+		{
+			if (iNow - File.Time > C4GroupCacheTempTimeout) EraseFile(*it);
+			continue;
+		}
+		iTotalSize += File.Size;
+		if (!szKeep || !SEqual(*it, szKeep)) Images.push_back(File);
+	}
+	std::sort(Images.begin(), Images.end(), [](const CacheFile &a, const CacheFile &b) { return a.Time < b.Time; });
+	for (auto it = Images.begin(); it != Images.end() && iTotalSize > C4Group_CacheMaxSize; ++it)
+		// images mapped by another process cannot be erased on Windows; they are tried again next time
+		if (EraseFile(it->Filename.c_str()))
+			iTotalSize -= it->Size;
+}
+
+static bool C4Group_OpenCacheImage(const char *szFilename, CStdFile &rFile)
+{
+	C4GroupCacheHeader Head{};
+	SCopy(C4GroupCacheID, Head.id, sizeof(Head.id) - 1);
+	Head.SourceSize = FileSize(szFilename);
+	Head.SourceTime = FileTime(szFilename);
+	if (Head.SourceSize < C4GroupCacheMinSize) return false;
+	// image name by group path
+	uint8_t Hash[StdSha1::DigestLength];
+	StdSha1 Sha1;
+	Sha1.Update(szFilename, SLen(szFilename));
+	Sha1.GetHash(Hash);
+	StdStrBuf Image;
+	Image.Format("%s%s-", C4Group_CachePath, GetFilename(szFilename));
+	for (const uint8_t byHash : Hash) Image.AppendFormat("%02x", byHash);
+	// use existing image and mark it as recently used, or create it and make room for it
+	if (C4Group_CheckCacheImage(Image.getData(), Head))
+	{
+#ifdef _WIN32
+		_utime(Image.getData(), nullptr);
+#else
+		utime(Image.getData(), nullptr);
+#endif
+	}
+	else
+	{
+		if (!DirectoryExists(C4Group_CachePath)) CreateDirectory(C4Group_CachePath);
+		if (!C4Group_WriteCacheImage(szFilename, Image.getData(), Head)) return false;
+		// an image that does not fit at all is not kept
+		if (FileSize(Image.getData()) > C4Group_CacheMaxSize)
+		{
+			EraseFile(Image.getData());
+			return false;
+		}
+		C4Group_TrimCache(Image.getData());
+	}
+	return rFile.OpenMapped(Image.getData(), C4GroupCacheDataOffset);
+}
+
+void C4Group_SetCachePath(const char *szPath, uint64_t iMaxSize)
+{
+	if (!szPath || !szPath[0]) { C4Group_CachePath[0] = 0; return; }
+	SCopy(szPath, C4Group_CachePath, _MAX_PATH); AppendBackslash(C4Group_CachePath);
+	C4Group_CacheMaxSize = iMaxSize;
+	// apply a changed size limit and remove leftovers right away
+	if (DirectoryExists(C4Group_CachePath)) C4Group_TrimCache();
+}
+
 bool C4Group_TestIgnore(const char *szFilename)
 {
 	return *GetFilename(szFilename) == '.' || SIsModule(C4Group_Ignore, GetFilename(szFilename));
@@ -623,7 +791,8 @@ void C4Group::Init()
 	EntryOffset = 0;
 	Modified = false;
 	Head.Init();
-	FirstEntry = nullptr;
+	FirstEntry = LastEntry = nullptr;
+	EntryIndex.clear();
 	SearchPtr = nullptr;
 	// Folder only
 	FolderSearch.Reset();
@@ -778,14 +947,19 @@ bool C4Group::OpenReal(const char *szFilename)
 }
 
 bool C4Group::OpenRealGrpFile()
+{
+	// Open StdFile: cached uncompressed image, if enabled
+	if (!C4Group_CachePath[0] || !C4Group_OpenCacheImage(FileName, StdFile))
+		if (!StdFile.Open(FileName, true)) return Error("OpenRealGrpFile: Cannot open standard file");
+
+	return ReadRealGrpFile();
+}
 
+bool C4Group::ReadRealGrpFile()
 {
 	int cnt, file_entries;
 	C4GroupEntryCore corebuf;
 
-	// Open StdFile
-	if (!StdFile.Open(FileName, true)) return Error("OpenRealGrpFile: Cannot open standard file");
-
 	// Read header
 	if (!StdFile.Read((uint8_t *)&Head, sizeof(C4GroupHeader))) return Error("OpenRealGrpFile: Error reading header");
 	MemScramble((uint8_t *)&Head, sizeof(C4GroupHeader));
@@ -815,6 +989,58 @@ bool C4Group::OpenRealGrpFile()
 	return true;
 }
 
+bool C4Group::OpenChildImage(C4Group *pMother, const char *szEntryName, const StdBuf &Image)
+{
+	if (!pMother) return Error("OpenChildImage: No mother specified");
+
+	// The image is read like a group file that is named by the full path of the child
+	Init();
+	SCopy((pMother->GetFullName() + DirSep + szEntryName).getData(), FileName, _MAX_FNAME);
+	if (!StdFile.OpenMemory(FileName, Image.getData(), Image.getSize()))
+	{
+		Clear(); return Error("OpenChildImage: Empty image");
+	}
+	if (!ReadRealGrpFile())
+	{
+		Clear(); return Error("OpenChildImage: Invalid image");
+	}
+	Status = GRPF_File;
+	ResetSearch();
+	return true;
+}
+
+bool C4Group::LoadChildImage(const char *szEntryName, StdBuf &Image)
+{
+	switch (Status)
+	{
+	case GRPF_File:
+	{
+		// Child groups are stored uncompressed in packed groups
+		C4GroupEntry *centry = GetEntry(szEntryName);
+		if (!centry || !centry->ChildGroup) return Error("LoadChildImage: Not a child group");
+		return LoadEntry(centry->FileName, Image);
+	}
+	case GRPF_Folder:
+	{
+		// Packed group file in folder: inflate whole file
+		char path[_MAX_FNAME + 1]; SCopy(FileName, path, _MAX_FNAME);
+		AppendBackslash(path); SAppend(szEntryName, path, _MAX_FNAME);
+		if (DirectoryExists(path)) return Error("LoadChildImage: Not packed");
+		const int iSize = UncompressedFileSize(path);
+		CStdFile hFile;
+		if (iSize <= 0 || !hFile.Open(path, true)) return Error("LoadChildImage: Cannot open file");
+		Image.New(iSize);
+		if (!hFile.Read(Image.getMData(), iSize))
+		{
+			Image.Clear();
+			return Error("LoadChildImage: Reading error");
+		}
+		return true;
+	}
+	}
+	return false;
+}
+
 bool C4Group::AddEntry(int status,
 	bool childgroup,
 	const char *fname,
@@ -875,8 +1101,8 @@ bool C4Group::AddEntry(int status,
 	// Allocate memory for new entry
 	if (!(nentry = new C4GroupEntry)) return false; // ...theoretically, delete Hold buffer here
 
-	// Find end of list
-	for (lentry = FirstEntry; lentry && lentry->Next; lentry = lentry->Next);
+	// End of list
+	lentry = LastEntry;
 
 	// Init entry core data
 	if (entryname) SCopy(entryname, nentry->FileName, _MAX_FNAME);
@@ -903,6 +1129,8 @@ bool C4Group::AddEntry(int status,
 	// Append entry to list
 	if (lentry) lentry->Next = nentry;
 	else FirstEntry = nentry;
+	LastEntry = nentry;
+	EntryIndex[GetEntryKey(nentry->FileName)] = nentry;
 
 	// Increase virtual file count of group
 	Head.Entries++;
@@ -913,6 +1141,12 @@ bool C4Group::AddEntry(int status,
 C4GroupEntry *C4Group::GetEntry(const char *szName)
 {
 	if (Status == GRPF_Folder) return nullptr;
+	// Exact name: look up in index
+	if (!std::strpbrk(szName, "*?"))
+	{
+		const auto it = EntryIndex.find(GetEntryKey(szName));
+		return it != EntryIndex.end() ? it->second : nullptr;
+	}
 	C4GroupEntry *centry;
 	for (centry = FirstEntry; centry; centry = centry->Next)
 		if (centry->Status != C4GRES_Deleted)
@@ -1223,6 +1457,14 @@ C4GroupEntry *C4Group::GetNextFolderEntry()
 	}
 }
 
+std::string C4Group::GetEntryKey(const char *szName)
+{
+	// case insensitive like WildcardMatch
+	std::string Key{szName};
+	for (char &c : Key) c = tolower(static_cast<unsigned char>(c));
+	return Key;
+}
+
 C4GroupEntry *C4Group::SearchNextEntry(const char *szName)
 {
 	// Wildcard "*.*" is expected to find all files: substitute correct wildcard "*"
@@ -1233,6 +1475,13 @@ C4GroupEntry *C4Group::SearchNextEntry(const char *szName)
 	switch (Status)
 	{
 	case GRPF_File:
+		// New search for exact name: look up in index
+		if (SearchPtr == FirstEntry && !std::strpbrk(szName, "*?"))
+		{
+			pEntry = GetEntry(szName);
+			SearchPtr = pEntry ? pEntry->Next : nullptr;
+			return pEntry;
+		}
 		for (pEntry = SearchPtr; pEntry; pEntry = pEntry->Next)
 			if (pEntry->Status != C4GRES_Deleted)
 				if (WildcardMatch(szName, pEntry->FileName))
@@ -1267,9 +1516,23 @@ bool C4Group::SetFilePtr(int iOffset)
 	// ensure mother is at correct pos
 	if (Mother) Mother->EnsureChildFilePtr(this);
 
-	// Rewind if necessary
+	// Move back if necessary
 	if (FilePtr > iOffset)
-		if (!RewindFilePtr()) return false;
+	{
+		// Regular group: seek in standard file, which resumes inflating at the closest checkpoint
+		if (!Mother)
+		{
+			if (!StdFile.Seek(EntryOffset + iOffset)) return false;
+			FilePtr = iOffset;
+		}
+		// Child group file: seek in mother
+		else if (Mother->Status == GRPF_File)
+		{
+			if (!Mother->SetFilePtr(MotherOffset + EntryOffset + iOffset)) return false;
+			FilePtr = iOffset;
+		}
+		else if (!RewindFilePtr()) return false;
+	}
 
 	// Advance to target pointer
 	if (FilePtr < iOffset)
@@ -1633,6 +1896,7 @@ bool C4Group::DeleteEntry(const char *szFilename, bool fRecycle)
 		// (moved buffers are deleted by ~C4GroupEntry)
 		// Delete status and update virtual file count
 		pEntry->Status = C4GRES_Deleted;
+		EntryIndex.erase(GetEntryKey(pEntry->FileName));
 		Head.Entries--;
 		break;
 	case GRPF_Folder:
@@ -1666,7 +1930,9 @@ bool C4Group::Rename(const char *szFile, const char *szNewName)
 		// Check double name
 		if (GetEntry(szNewName) && !SEqualNoCase(szNewName, szFile)) return Error("Rename: File exists already");
 		// Rename
+		EntryIndex.erase(GetEntryKey(pEntry->FileName));
 		SCopy(szNewName, pEntry->FileName, _MAX_FNAME);
+		EntryIndex[GetEntryKey(pEntry->FileName)] = pEntry;
 		Modified = true;
 		break;
 	case GRPF_Folder:
@@ -2350,6 +2616,9 @@ bool C4Group::Sort(const char *szSortList)
 			}
 	} while (fBubble);
 
+	// Find new end of list
+	for (LastEntry = FirstEntry; LastEntry && LastEntry->Next; LastEntry = LastEntry->Next);
+
 	return true;
 }
 
@@ -25,6 +25,9 @@
 #include <StdBuf.h>
 #include <StdCompiler.h>
 
+#include <string>
+#include <unordered_map>
+
 // C4Group-Rewind-warning:
 // The current C4Group-implementation cannot handle random file access very well,
 // because all files are written within a single zlib-stream.
@@ -63,6 +66,8 @@ const int C4GroupMaxMaker = 30,
 void C4Group_SetMaker(const char *szMaker);
 void C4Group_SetTempPath(const char *szPath);
 const char *C4Group_GetTempPath();
+void C4Group_SetCachePath(const char *szPath, uint64_t iMaxSize); // packed groups are read from uncompressed images cached here, least recently used ones are removed beyond iMaxSize bytes; nullptr disables
+void C4Group_SetCompressionThreads(int iThreads); // threads for writing packed groups; 0: one per hardware thread
 void C4Group_SetSortList(const char **ppSortList);
 void C4Group_SetProcessCallback(bool(*fnCallback)(const char *, int));
 bool C4Group_IsGroup(const char *szFilename);
@@ -177,6 +182,8 @@ protected:
 	bool Modified;
 	C4GroupHeader Head;
 	C4GroupEntry *FirstEntry;
+	C4GroupEntry *LastEntry;
+	std::unordered_map<std::string, C4GroupEntry *> EntryIndex; // entries not deleted by lower case name
 	// Folder only
 	DirectoryIterator FolderSearch;
 	C4GroupEntry FolderSearchEntry;
@@ -194,6 +201,8 @@ public:
 	bool Close();
 	bool Save(bool fReOpen);
 	bool OpenAsChild(C4Group *pMother, const char *szEntryName, bool fExclusive = false);
+	bool OpenChildImage(C4Group *pMother, const char *szEntryName, const StdBuf &Image); // read-only; Image must outlive the group
+	bool LoadChildImage(const char *szEntryName, StdBuf &Image); // load uncompressed contents of a packed child group
 	bool OpenChild(const char *strEntry);
 	bool OpenMother();
 	bool Add(const char *szFiles);
@@ -268,6 +277,7 @@ protected:
 	bool Error(const char *szStatus);
 	bool OpenReal(const char *szGroupName);
 	bool OpenRealGrpFile();
+	bool ReadRealGrpFile();
 	bool SetFilePtr(int iOffset);
 	bool RewindFilePtr();
 	bool AdvanceFilePtr(int iOffset, C4Group *pByChild = nullptr);
@@ -288,6 +298,7 @@ protected:
 	bool SetFilePtr2Entry(const char *szName, C4Group *pByChild = nullptr);
 	bool AppendEntry2StdFile(C4GroupEntry *centry, CStdFile &stdfile);
 	C4GroupEntry *GetEntry(const char *szName);
+	static std::string GetEntryKey(const char *szName);
 	C4GroupEntry *SearchNextEntry(const char *szName);
 	C4GroupEntry *GetNextFolderEntry();
 	bool CalcCRC32(C4GroupEntry *pEntry);
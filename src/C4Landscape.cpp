@@ -87,17 +87,17 @@ void C4Landscape::ExecuteScan()
 {
 	int32_t cy, mat;
 
-	// Check: Scan needed?
+	// Check: Scan needed? Collect all materials to be converted
 	const int32_t iTemperature = Game.Weather.GetTemperature();
+	int32_t ScanMats[C4MaxMaterial], iScanMatCnt = 0;
 	for (mat = 0; mat < Game.Material.Num; mat++)
 		if (MatCount[mat])
-			if (Game.Material.Map[mat].BelowTempConvertTo &&
-				iTemperature < Game.Material.Map[mat].BelowTempConvert)
-				break;
-			else if (Game.Material.Map[mat].AboveTempConvertTo &&
-				iTemperature > Game.Material.Map[mat].AboveTempConvert)
-				break;
-	if (mat >= Game.Material.Num)
+			if ((Game.Material.Map[mat].BelowTempConvertTo &&
+				iTemperature < Game.Material.Map[mat].BelowTempConvert) ||
+				(Game.Material.Map[mat].AboveTempConvertTo &&
+				iTemperature > Game.Material.Map[mat].AboveTempConvert))
+				ScanMats[iScanMatCnt++] = mat;
+	if (!iScanMatCnt)
 		return;
 
 #ifdef DEBUGREC_MATSCAN
@@ -106,23 +106,37 @@ void C4Landscape::ExecuteScan()
 
 	for (int32_t cnt = 0; cnt < ScanSpeed; cnt++)
 	{
-		// Scan landscape column: sectors down
-		int32_t last_mat = -1;
-		for (cy = 0; cy < Height; cy++)
+		// Skip columns without any of these materials: nothing would be converted there
+		int32_t i = 0;
+		if (!ScanColCount.empty())
+			for (; i < iScanMatCnt; i++)
+				if (ScanColCount[ScanX * ScanMatNum + Mat2ScanIndex[ScanMats[i]]])
+					break;
+		if (i < iScanMatCnt)
 		{
-			mat = _GetMat(ScanX, cy);
-			// material change?
-			if (last_mat != mat)
+			// Scan landscape column: sectors down
+			int32_t last_mat = -1;
+			for (cy = 0; cy < Height; cy++)
 			{
-				// upwards
-				if (last_mat != -1)
-					DoScan(ScanX, cy - 1, last_mat, 1);
-				// downwards
-				if (mat != -1)
-					cy += DoScan(ScanX, cy, mat, 0);
+				mat = _GetMat(ScanX, cy);
+				// material change?
+				if (last_mat != mat)
+				{
+					// upwards
+					if (last_mat != -1)
+						DoScan(ScanX, cy - 1, last_mat, 1);
+					// downwards
+					if (mat != -1)
+						cy += DoScan(ScanX, cy, mat, 0);
+				}
+				last_mat = mat;
 			}
-			last_mat = mat;
 		}
+#ifndef NDEBUG
+		else
+			for (cy = 0; cy < Height; cy++)
+				assert(std::find(ScanMats, ScanMats + iScanMatCnt, _GetMat(ScanX, cy)) == ScanMats + iScanMatCnt);
+#endif
 
 		// Scan advance & rewind
 		ScanX++;
@@ -253,6 +267,17 @@ void C4Landscape::Clear(bool fClearMapCreator, bool fClearSky)
 	// clear pixel count
 	delete[] PixCnt;         PixCnt           = nullptr;
 	PixCntPitch = 0;
+	// clear density planes
+	SolidPlane.clear(); LiquidPlane.clear();
+	PlanePitch = 0;
+	// clear scan column counts
+	ScanColCount.clear();
+	std::fill_n(Mat2ScanIndex, C4MaxMaterial, -1);
+	ScanMatNum = 0;
+	// clear relights
+	RelightTiles.clear();
+	RelightTilesWdt = RelightTilesHgt = 0;
+	fRelightsPending = false;
 }
 
 void C4Landscape::Draw(C4FacetEx &cgo, int32_t iPlayer)
@@ -275,14 +300,14 @@ int32_t C4Landscape::ChunkyRandom(int32_t &iOffset, int32_t iRange)
 	return (iOffset ^ MapSeed) % iRange;
 }
 
-void C4Landscape::DrawChunk(int32_t tx, int32_t ty, int32_t wdt, int32_t hgt, int32_t mcol, int32_t iChunkType, int32_t cro)
+void C4Landscape::DrawChunk(CSurface8 *sfcTarget, int32_t tx, int32_t ty, int32_t wdt, int32_t hgt, int32_t mcol, int32_t iChunkType, int32_t cro)
 {
 	uint8_t top_rough; uint8_t side_rough;
 	// what to do?
 	switch (iChunkType)
 	{
 	case C4M_Flat:
-		Surface8->Box(tx, ty, tx + wdt, ty + hgt, mcol);
+		sfcTarget->Box(tx, ty, tx + wdt, ty + hgt, mcol);
 		return;
 	case C4M_TopFlat:
 		top_rough = 0; side_rough = 1;
@@ -306,10 +331,10 @@ void C4Landscape::DrawChunk(int32_t tx, int32_t ty, int32_t wdt, int32_t hgt, in
 	vtcs[12] = tx + wdt + ChunkyRandom(cro, rx / 2);          vtcs[13] = ty - ChunkyRandom(cro, rx / 2 * top_rough);
 	vtcs[14] = tx + wdt / 2;                                  vtcs[15] = ty - ChunkyRandom(cro, rx * top_rough);
 
-	Surface8->Polygon(8, vtcs, mcol);
+	sfcTarget->Polygon(8, vtcs, mcol);
 }
 
-void C4Landscape::DrawSmoothOChunk(int32_t tx, int32_t ty, int32_t wdt, int32_t hgt, int32_t mcol, uint8_t flip, int32_t cro)
+void C4Landscape::DrawSmoothOChunk(CSurface8 *sfcTarget, int32_t tx, int32_t ty, int32_t wdt, int32_t hgt, int32_t mcol, uint8_t flip, int32_t cro)
 {
 	int vtcs[8];
 	int32_t rx = (std::max)(wdt / 2, 1);
@@ -328,10 +353,10 @@ void C4Landscape::DrawSmoothOChunk(int32_t tx, int32_t ty, int32_t wdt, int32_t
 		vtcs[6] = tx + wdt / 2; vtcs[7] = ty + hgt / 3;
 	}
 
-	Surface8->Polygon(4, vtcs, mcol);
+	sfcTarget->Polygon(4, vtcs, mcol);
 }
 
-void C4Landscape::ChunkOZoom(CSurface8 *sfcMap, int32_t iMapX, int32_t iMapY, int32_t iMapWdt, int32_t iMapHgt, int32_t iTexture, int32_t iOffX, int32_t iOffY)
+void C4Landscape::ChunkOZoom(CSurface8 *sfcTarget, CSurface8 *sfcMap, int32_t iMapX, int32_t iMapY, int32_t iMapWdt, int32_t iMapHgt, int32_t iTexture, int32_t iOffX, int32_t iOffY)
 {
 	int32_t iX, iY, iChunkWidth, iChunkHeight, iToX, iToY;
 	int32_t iIFT;
@@ -348,8 +373,6 @@ void C4Landscape::ChunkOZoom(CSurface8 *sfcMap, int32_t iMapX, int32_t iMapY, in
 	iMapWdt = BoundBy<int32_t>(iMapWdt, 0, iMapWidth - iMapX); iMapHgt = BoundBy<int32_t>(iMapHgt, 0, iMapHeight - iMapY);
 	// get chunk size
 	iChunkWidth = MapZoom; iChunkHeight = MapZoom;
-	Surface32->Lock();
-	if (AnimationSurface) AnimationSurface->Lock();
 	// Scan map lines
 	for (iY = iMapY; iY < iMapY + iMapHgt; iY++)
 	{
@@ -370,7 +393,7 @@ void C4Landscape::ChunkOZoom(CSurface8 *sfcMap, int32_t iMapX, int32_t iMapY, in
 				// Determine IFT
 				iIFT = 0; if (byMapPixel >= 128) iIFT = IFT;
 				// Draw chunk
-				DrawChunk(iToX, iToY, iChunkWidth, iChunkHeight, byColor + iIFT, pMaterial->MapChunkType, (iX << 2) + iY);
+				DrawChunk(sfcTarget, iToX, iToY, iChunkWidth, iChunkHeight, byColor + iIFT, pMaterial->MapChunkType, (iX << 2) + iY);
 			}
 			// Other chunk, check for slope smoothers
 			else
@@ -383,7 +406,7 @@ void C4Landscape::ChunkOZoom(CSurface8 *sfcMap, int32_t iMapX, int32_t iMapY, in
 						// Determine IFT
 						iIFT = 0; if (sfcMap->GetPix(iX - 1, iY) >= 128) iIFT = IFT;
 						// Draw smoother
-						DrawSmoothOChunk(iToX, iToY, iChunkWidth, iChunkHeight, byColor + iIFT, 0, (iX << 2) + iY);
+						DrawSmoothOChunk(sfcTarget, iToX, iToY, iChunkWidth, iChunkHeight, byColor + iIFT, 0, (iX << 2) + iY);
 					}
 					// Same texture-material on right
 					if ((iX < iMapWidth - 1) && ((sfcMap->GetPix(iX + 1, iY) & 127) == iTexture))
@@ -391,13 +414,11 @@ void C4Landscape::ChunkOZoom(CSurface8 *sfcMap, int32_t iMapX, int32_t iMapY, in
 						// Determine IFT
 						iIFT = 0; if (sfcMap->GetPix(iX + 1, iY) >= 128) iIFT = IFT;
 						// Draw smoother
-						DrawSmoothOChunk(iToX, iToY, iChunkWidth, iChunkHeight, byColor + iIFT, 1, (iX << 2) + iY);
+						DrawSmoothOChunk(sfcTarget, iToX, iToY, iChunkWidth, iChunkHeight, byColor + iIFT, 1, (iX << 2) + iY);
 					}
 				}
 		}
 	}
-	Surface32->Unlock();
-	if (AnimationSurface) AnimationSurface->Unlock();
 }
 
 bool C4Landscape::GetTexUsage(CSurface8 *sfcMap, int32_t iMapX, int32_t iMapY, int32_t iMapWdt, int32_t iMapHgt, uint32_t *dwpTextureUsage)
@@ -419,18 +440,55 @@ bool C4Landscape::GetTexUsage(CSurface8 *sfcMap, int32_t iMapX, int32_t iMapY, i
 	return true;
 }
 
-bool C4Landscape::TexOZoom(CSurface8 *sfcMap, int32_t iMapX, int32_t iMapY, int32_t iMapWdt, int32_t iMapHgt, uint32_t *dwpTextureUsage, int32_t iToX, int32_t iToY)
+namespace
 {
-	int32_t iIndex;
-
-	// ChunkOZoom all used textures
-	for (iIndex = 1; iIndex < C4M_MaxTexIndex; iIndex++)
-		if (dwpTextureUsage[iIndex] > 0)
+	// Surface8 restricted to a band of rows, so bands can be drawn concurrently
+	// The pixels are shared with the landscape surface and not owned.
+	class C4LandscapeBandSurface : public CSurface8
+	{
+	public:
+		C4LandscapeBandSurface(CSurface8 &rSurface, int iY, int iY2)
 		{
-			// ChunkOZoom map to landscape
-			ChunkOZoom(sfcMap, iMapX, iMapY, iMapWdt, iMapHgt, iIndex, iToX, iToY);
+			Wdt = rSurface.Wdt; Hgt = rSurface.Hgt; Pitch = rSurface.Pitch;
+			Bits = rSurface.Bits; pPal = rSurface.pPal;
+			ClipX = rSurface.ClipX; ClipX2 = rSurface.ClipX2;
+			ClipY = iY; ClipY2 = iY2;
 		}
 
+		~C4LandscapeBandSurface() { Bits = nullptr; pPal = nullptr; }
+	};
+
+	const int32_t C4LS_ZoomBandHgt = 256; // minimum number of landscape rows zoomed at once
+}
+
+bool C4Landscape::TexOZoom(CSurface8 *sfcMap, int32_t iMapX, int32_t iMapY, int32_t iMapWdt, int32_t iMapHgt, uint32_t *dwpTextureUsage, int32_t iToX, int32_t iToY)
+{
+	// Clip map segment the same way ChunkOZoom does
+	int iMapWidth, iMapHeight;
+	sfcMap->GetSurfaceSize(iMapWidth, iMapHeight);
+	iMapX = BoundBy<int32_t>(iMapX, 0, iMapWidth - 1); iMapY = BoundBy<int32_t>(iMapY, 0, iMapHeight - 1);
+	iMapWdt = BoundBy<int32_t>(iMapWdt, 0, iMapWidth - iMapX); iMapHgt = BoundBy<int32_t>(iMapHgt, 0, iMapHeight - iMapY);
+
+	// Split the clipped target into bands of rows. Each band draws all chunks that may reach into it,
+	// in the same order as a single pass would, so the output does not depend on the band layout.
+	const int32_t iTop = Surface8->ClipY, iBottom = Surface8->ClipY2 + 1;
+	if (iBottom <= iTop) return true;
+	const int32_t iBandHgt = (std::max)(C4LS_ZoomBandHgt, 32 * MapZoom);
+	const int32_t iBandCount = (iBottom - iTop + iBandHgt - 1) / iBandHgt;
+	Application.ThreadPool.ParallelFor(iBandCount, [&](size_t i)
+	{
+		const int32_t iBandY = iTop + static_cast<int32_t>(i) * iBandHgt, iBandY2 = (std::min)(iBandY + iBandHgt, iBottom);
+		C4LandscapeBandSurface sfcBand(*Surface8, iBandY, iBandY2 - 1);
+		// chunks reach up to half a chunk above and two chunks below their map pixel
+		const int32_t iBandMapY = (std::max)((iBandY - iToY) / MapZoom - 4, iMapY);
+		const int32_t iBandMapY2 = (std::min)((iBandY2 - iToY) / MapZoom + 3, iMapY + iMapHgt);
+		if (iBandMapY2 <= iBandMapY) return;
+		// ChunkOZoom all used textures
+		for (int32_t iIndex = 1; iIndex < C4M_MaxTexIndex; iIndex++)
+			if (dwpTextureUsage[iIndex] > 0)
+				ChunkOZoom(&sfcBand, sfcMap, iMapX, iBandMapY, iMapWdt, iBandMapY2 - iBandMapY, iIndex, iToX, iToY);
+	});
+
 	// Done
 	return true;
 }
@@ -713,8 +771,13 @@ bool C4Landscape::Init(C4Group &hGroup, bool fOverloadCurrent, bool fLoadSky, bo
 	PixCntPitch = (Height + 14) / 15;
 	PixCnt = new uint8_t[PixCntWidth * PixCntPitch];
 	UpdatePixCnt(C4Rect(0, 0, Width, Height));
+	InitPlanes();
 	ClearMatCount();
 	UpdateMatCnt(C4Rect(0, 0, Width, Height), true);
+	InitScanCounts();
+
+	// Create relight tiles
+	InitRelights();
 
 	// Save initial landscape
 	if (!SaveInitial())
@@ -749,13 +812,7 @@ bool C4Landscape::SetPix(int32_t x, int32_t y, uint8_t npix)
 	if (npix == _GetPix(x, y))
 		return true;
 	// note for relight
-	C4Rect CheckRect(x - 2 * C4LS_MaxLightDistX, y - 2 * C4LS_MaxLightDistY, 4 * C4LS_MaxLightDistX + 1, 4 * C4LS_MaxLightDistY + 1);
-	for (int32_t i = 0; i < C4LS_MaxRelights; i++)
-		if (!Relights[i].Wdt || Relights[i].Overlap(CheckRect) || i + 1 >= C4LS_MaxRelights)
-		{
-			Relights[i].Add(C4Rect(x, y, 1, 1));
-			break;
-		}
+	AddRelight(x, y);
 	// set pixel
 	return _SetPix(x, y, npix);
 }
@@ -831,6 +888,14 @@ bool C4Landscape::_SetPix(int32_t x, int32_t y, uint8_t npix)
 	}
 	// set 8bpp-surface only!
 	Surface8->SetPix(x, y, npix);
+	// the pixel may have been clipped
+	const uint8_t rpix = _GetPix(x, y);
+	SetPlanes(x, y, Pix2Planes[rpix]);
+	if (rpix != opix)
+	{
+		CountScanPix(x, Pix2Mat[opix], -1);
+		CountScanPix(x, Pix2Mat[rpix], +1);
+	}
 	// success
 	return true;
 }
@@ -1094,11 +1159,9 @@ void C4Landscape::RaiseTerrain(int32_t tx, int32_t ty, int32_t wdt)
 
 int32_t C4Landscape::AreaSolidCount(int32_t x, int32_t y, int32_t wdt, int32_t hgt)
 {
-	int32_t cx, cy, ascnt = 0;
-	for (cy = y; cy < y + hgt; cy++)
-		for (cx = x; cx < x + wdt; cx++)
-			if (GBackSolid(cx, cy))
-				ascnt++;
+	int32_t ascnt = 0;
+	for (int32_t cy = y; cy < y + hgt; cy++)
+		ascnt += CountInPlanes(C4LS_PlaneSolid, x, cy, wdt);
 	return ascnt;
 }
 
@@ -1644,6 +1707,11 @@ void C4Landscape::Default()
 	pMapCreator = nullptr;
 	Modulation = 0;
 	fMapChanged = false;
+	RelightTilesWdt = RelightTilesHgt = 0;
+	fRelightsPending = false;
+	PlanePitch = 0;
+	std::fill_n(Mat2ScanIndex, C4MaxMaterial, -1);
+	ScanMatNum = 0;
 }
 
 void C4Landscape::ClearBlastMatCount()
@@ -1975,11 +2043,20 @@ bool FindConSiteSpot(int32_t &rx, int32_t &ry, int32_t wdt, int32_t hgt,
 
 bool PathFreePix(int32_t x, int32_t y, int32_t par)
 {
-	return !GBackSolid(x, y);
+	return !Game.Landscape.InPlanes(C4LS_PlaneSolid, x, y);
 }
 
 bool PathFree(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t *ix, int32_t *iy)
 {
+	// horizontal paths are checked a word at a time
+	if (y1 == y2)
+	{
+		int32_t x;
+		if (!Game.Landscape.FindInPlanes(C4LS_PlaneSolid, (std::min)(x1, x2), y1, Abs(x2 - x1) + 1, x)) return true;
+		if (ix) *ix = x;
+		if (iy) *iy = y1;
+		return false;
+	}
 	return ForLine(x1, y1, x2, y2, &PathFreePix, 0, ix, iy);
 }
 
@@ -2376,7 +2453,7 @@ bool C4Landscape::DrawChunks(int32_t tx, int32_t ty, int32_t wdt, int32_t hgt, i
 	int32_t x, y;
 	for (x = 0; x < icntx; x++)
 		for (y = 0; y < icnty; y++)
-			DrawChunk(tx + wdt * x / icntx, ty + hgt * y / icnty, wdt / icntx, hgt / icnty, byColor, Game.Material.Map[iMaterial].MapChunkType, Random(1000));
+			DrawChunk(Surface8, tx + wdt * x / icntx, ty + hgt * y / icnty, wdt / icntx, hgt / icnty, byColor, Game.Material.Map[iMaterial].MapChunkType, Random(1000));
 
 	// remove clipper
 	Surface8->NoClip();
@@ -2420,29 +2497,65 @@ uint8_t C4Landscape::GetMapIndex(int32_t iX, int32_t iY)
 #define C4LSLGT_2 8
 #define C4LSLGT_3 4
 
+void C4Landscape::InitRelights()
+{
+	const int32_t iWdt = (Width + C4LS_RelightTileSize - 1) / C4LS_RelightTileSize;
+	const int32_t iHgt = (Height + C4LS_RelightTileSize - 1) / C4LS_RelightTileSize;
+	// keep relights noted so far
+	if (iWdt == RelightTilesWdt && iHgt == RelightTilesHgt && !RelightTiles.empty()) return;
+	RelightTilesWdt = iWdt; RelightTilesHgt = iHgt;
+	RelightTiles.assign(iWdt * iHgt, false);
+	fRelightsPending = false;
+}
+
+void C4Landscape::AddRelight(int32_t x, int32_t y)
+{
+	if (RelightTiles.empty()) InitRelights();
+	RelightTiles[y / C4LS_RelightTileSize * RelightTilesWdt + x / C4LS_RelightTileSize] = true;
+	fRelightsPending = true;
+}
+
 bool C4Landscape::DoRelights()
 {
-	for (int32_t i = 0; i < C4LS_MaxRelights; i++)
+	if (!fRelightsPending) return true;
+	fRelightsPending = false;
+	const auto fnRunDirty = [this](int32_t tx1, int32_t tx2, int32_t ty)
 	{
-		if (!Relights[i].Wdt)
-			break;
-		C4Rect SolidMaskRect = Relights[i];
-		SolidMaskRect.x -= 2 * C4LS_MaxLightDistX; SolidMaskRect.y -= 2 * C4LS_MaxLightDistY;
-		SolidMaskRect.Wdt += 4 * C4LS_MaxLightDistX; SolidMaskRect.Hgt += 4 * C4LS_MaxLightDistY;
-		C4SolidMask *pSolid;
-		for (pSolid = C4SolidMask::Last; pSolid; pSolid = pSolid->Prev)
-		{
-			pSolid->RemoveTemporary(SolidMaskRect);
-		}
-		Relight(Relights[i]);
-		// Restore Solidmasks
-		for (pSolid = C4SolidMask::First; pSolid; pSolid = pSolid->Next)
+		for (int32_t tx = tx1; tx < tx2; ++tx)
+			if (!RelightTiles[ty * RelightTilesWdt + tx]) return false;
+		return true;
+	};
+	// Relight changed tiles in rectangles: A run of changed tiles in a row is extended downwards
+	// as long as the rows below have the same run changed
+	for (int32_t ty = 0; ty < RelightTilesHgt; ++ty)
+		for (int32_t tx = 0; tx < RelightTilesWdt; ++tx)
 		{
-			pSolid->PutTemporary(SolidMaskRect);
+			if (!RelightTiles[ty * RelightTilesWdt + tx]) continue;
+			int32_t tx2 = tx + 1, ty2 = ty + 1;
+			while (tx2 < RelightTilesWdt && RelightTiles[ty * RelightTilesWdt + tx2]) ++tx2;
+			while (ty2 < RelightTilesHgt && fnRunDirty(tx, tx2, ty2)) ++ty2;
+			for (int32_t y = ty; y < ty2; ++y)
+				for (int32_t x = tx; x < tx2; ++x)
+					RelightTiles[y * RelightTilesWdt + x] = false;
+			const C4Rect RelightRect(tx * C4LS_RelightTileSize, ty * C4LS_RelightTileSize, (tx2 - tx) * C4LS_RelightTileSize, (ty2 - ty) * C4LS_RelightTileSize);
+			C4Rect SolidMaskRect = RelightRect;
+			SolidMaskRect.x -= 2 * C4LS_MaxLightDistX; SolidMaskRect.y -= 2 * C4LS_MaxLightDistY;
+			SolidMaskRect.Wdt += 4 * C4LS_MaxLightDistX; SolidMaskRect.Hgt += 4 * C4LS_MaxLightDistY;
+			// solid masks outside of the rect are skipped by RemoveTemporary and PutTemporary
+			C4SolidMask *pSolid;
+			for (pSolid = C4SolidMask::Last; pSolid; pSolid = pSolid->Prev)
+			{
+				pSolid->RemoveTemporary(SolidMaskRect);
+			}
+			Relight(RelightRect);
+			// Restore Solidmasks
+			for (pSolid = C4SolidMask::First; pSolid; pSolid = pSolid->Next)
+			{
+				pSolid->PutTemporary(SolidMaskRect);
+			}
+			C4SolidMask::CheckConsistency();
+			tx = tx2 - 1;
 		}
-		Relights[i].Default();
-		C4SolidMask::CheckConsistency();
-	}
 	return true;
 }
 
@@ -2455,6 +2568,20 @@ bool C4Landscape::Relight(C4Rect To)
 	return ApplyLighting(To);
 }
 
+namespace
+{
+	// how a pixel is written after lighting
+	enum C4LightingPixel : uint8_t
+	{
+		LP_None,    // left cleared
+		LP_Color,   // color only
+		LP_Solid,   // color; animation surface cleared
+		LP_Liquid,  // color; animation surface marks liquid
+	};
+
+	const int32_t C4LS_LightingStripeWdt = 256; // columns lit at once
+}
+
 bool C4Landscape::ApplyLighting(C4Rect To)
 {
 	// clip to landscape size
@@ -2469,54 +2596,84 @@ bool C4Landscape::ApplyLighting(C4Rect To)
 		AnimationSurface->Lock();
 		AnimationSurface->ClearBoxDw(To.x, To.y, To.Wdt, To.Hgt);
 	}
-	// do lightning
-	for (int32_t iX = To.x; iX < To.x + To.Wdt; ++iX)
+	// Colors are calculated concurrently in stripes of columns and written to the surfaces afterwards,
+	// because surfaces lock their textures on demand. Columns are stored consecutively.
+	const int32_t iStripeWdt = (std::min)(To.Wdt, C4LS_LightingStripeWdt);
+	std::vector<uint32_t> Colors(iStripeWdt * To.Hgt);
+	std::vector<uint8_t> Modes(iStripeWdt * To.Hgt);
+	for (int32_t iStripeX = To.x; iStripeX < To.x + To.Wdt; iStripeX += iStripeWdt)
 	{
-		int AboveDensity = 0, BelowDensity = 0;
-		for (int i = 1; i <= 8; ++i)
-		{
-			AboveDensity += GetPlacement(iX, To.y - i - 1);
-			BelowDensity += GetPlacement(iX, To.y + i - 1);
-		}
-		for (int32_t iY = To.y; iY < To.y + To.Hgt; ++iY)
+		const int32_t iColumns = (std::min)(iStripeWdt, To.x + To.Wdt - iStripeX);
+		// do lightning
+		Application.ThreadPool.ParallelFor(iColumns, [&](size_t iColumn)
 		{
-			AboveDensity -= GetPlacement(iX, iY - 9);
-			AboveDensity += GetPlacement(iX, iY - 1);
-			BelowDensity -= GetPlacement(iX, iY);
-			BelowDensity += GetPlacement(iX, iY + 8);
-			uint8_t pix = _GetPix(iX, iY);
-			// Sky
-			if (!pix)
-			{
-				Surface32->SetPixDw(iX, iY, GetClrByTex(iX, iY));
-				continue;
-			}
-			// get density
-			int iOwnDens = Pix2Place[pix];
-			if (!iOwnDens) continue;
-			iOwnDens *= 2;
-			iOwnDens += GetPlacement(iX + 1, iY) + GetPlacement(iX - 1, iY);
-			iOwnDens /= 4;
-			// Normal color
-			uint32_t dwBackClr = GetClrByTex(iX, iY);
-			// get density of surrounding materials
-			int iCompareDens = AboveDensity / 8;
-			if (iOwnDens > iCompareDens)
+			const int32_t iX = iStripeX + static_cast<int32_t>(iColumn);
+			uint32_t *pColor = &Colors[iColumn * To.Hgt];
+			uint8_t *pMode = &Modes[iColumn * To.Hgt];
+			int AboveDensity = 0, BelowDensity = 0;
+			for (int i = 1; i <= 8; ++i)
 			{
-				// apply light
-				LightenClrBy(dwBackClr, (std::min)(30, 2 * (iOwnDens - iCompareDens)));
+				AboveDensity += GetPlacement(iX, To.y - i - 1);
+				BelowDensity += GetPlacement(iX, To.y + i - 1);
 			}
-			else if (iOwnDens < iCompareDens && iOwnDens < 30)
+			for (int32_t iY = To.y; iY < To.y + To.Hgt; ++iY, ++pColor, ++pMode)
 			{
-				DarkenClrBy(dwBackClr, (std::min)(30, 2 * (iCompareDens - iOwnDens)));
+				AboveDensity -= GetPlacement(iX, iY - 9);
+				AboveDensity += GetPlacement(iX, iY - 1);
+				BelowDensity -= GetPlacement(iX, iY);
+				BelowDensity += GetPlacement(iX, iY + 8);
+				uint8_t pix = _GetPix(iX, iY);
+				// Sky
+				if (!pix)
+				{
+					*pColor = GetClrByTex(iX, iY);
+					*pMode = LP_Color;
+					continue;
+				}
+				// get density
+				int iOwnDens = Pix2Place[pix];
+				if (!iOwnDens)
+				{
+					*pMode = LP_None;
+					continue;
+				}
+				iOwnDens *= 2;
+				iOwnDens += GetPlacement(iX + 1, iY) + GetPlacement(iX - 1, iY);
+				iOwnDens /= 4;
+				// Normal color
+				uint32_t dwBackClr = GetClrByTex(iX, iY);
+				// get density of surrounding materials
+				int iCompareDens = AboveDensity / 8;
+				if (iOwnDens > iCompareDens)
+				{
+					// apply light
+					LightenClrBy(dwBackClr, (std::min)(30, 2 * (iOwnDens - iCompareDens)));
+				}
+				else if (iOwnDens < iCompareDens && iOwnDens < 30)
+				{
+					DarkenClrBy(dwBackClr, (std::min)(30, 2 * (iCompareDens - iOwnDens)));
+				}
+				iCompareDens = BelowDensity / 8;
+				if (iOwnDens > iCompareDens)
+				{
+					DarkenClrBy(dwBackClr, (std::min)(30, 2 * (iOwnDens - iCompareDens)));
+				}
+				*pColor = dwBackClr;
+				*pMode = DensityLiquid(Pix2Dens[pix]) ? LP_Liquid : LP_Solid;
 			}
-			iCompareDens = BelowDensity / 8;
-			if (iOwnDens > iCompareDens)
+		});
+		// write the stripe
+		for (int32_t iColumn = 0; iColumn < iColumns; ++iColumn)
+		{
+			const int32_t iX = iStripeX + iColumn;
+			const uint32_t *pColor = &Colors[iColumn * To.Hgt];
+			const uint8_t *pMode = &Modes[iColumn * To.Hgt];
+			for (int32_t iY = To.y; iY < To.y + To.Hgt; ++iY, ++pColor, ++pMode)
 			{
-				DarkenClrBy(dwBackClr, (std::min)(30, 2 * (iOwnDens - iCompareDens)));
+				if (*pMode == LP_None) continue;
+				Surface32->SetPixDw(iX, iY, *pColor);
+				if (AnimationSurface && *pMode != LP_Color) AnimationSurface->SetPixDw(iX, iY, *pMode == LP_Liquid ? 255 << 24 : 0);
 			}
-			Surface32->SetPixDw(iX, iY, dwBackClr);
-			if (AnimationSurface) AnimationSurface->SetPixDw(iX, iY, DensityLiquid(Pix2Dens[pix]) ? 255 << 24 : 0);
 		}
 	}
 	Surface32->Unlock();
@@ -2723,6 +2880,14 @@ void C4Landscape::UpdatePixMaps()
 	for (i = 0; i < 256; i++) Pix2Dens[i] = MatDensity(Pix2Mat[i]);
 	for (i = 0; i < 256; i++) Pix2Place[i] = MatValid(Pix2Mat[i]) ? Game.Material.Map[Pix2Mat[i]].Placement : 0;
 	Pix2Place[0] = 0;
+	for (i = 0; i < 256; i++) Pix2Planes[i] = (DensitySolid(Pix2Dens[i]) ? C4LS_PlaneSolid : 0) | (DensityLiquid(Pix2Dens[i]) ? C4LS_PlaneLiquid : 0);
+	PlaneDensities.assign(Pix2Dens, Pix2Dens + 256);
+	std::sort(PlaneDensities.begin(), PlaneDensities.end());
+	PlaneDensities.erase(std::unique(PlaneDensities.begin(), PlaneDensities.end()), PlaneDensities.end());
+	// planes of existing pixels may have changed
+	if (PlanePitch) UpdatePlanes(C4Rect(0, 0, Width, Height));
+	// as may the materials of scan column counts
+	if (!ScanColCount.empty()) InitScanCounts();
 }
 
 bool C4Landscape::Mat2Pal()
@@ -2774,7 +2939,11 @@ void C4Landscape::FinishChange(C4Rect BoundingBox, const bool updateMatAndPixCnt
 	{
 		pSolid->Repair(SolidMaskRect);
 	}
-	if (updateMatAndPixCnt) UpdatePixCnt(BoundingBox);
+	if (updateMatAndPixCnt)
+	{
+		UpdatePixCnt(BoundingBox);
+		UpdatePlanes(BoundingBox);
+	}
 	C4SolidMask::CheckConsistency();
 }
 
@@ -2795,6 +2964,153 @@ void C4Landscape::UpdatePixCnt(const C4Rect &Rect, bool fCheck)
 		}
 }
 
+void C4Landscape::InitPlanes()
+{
+	PlanePitch = (Width + 63) / 64;
+	SolidPlane.assign(PlanePitch * Height, 0);
+	LiquidPlane.assign(PlanePitch * Height, 0);
+	UpdatePlanes(C4Rect(0, 0, Width, Height));
+}
+
+void C4Landscape::UpdatePlanes(const C4Rect &Rect)
+{
+	if (!PlanePitch) return;
+	const int32_t iX2 = std::min<int32_t>(Rect.x + Rect.Wdt, Width), iY2 = std::min<int32_t>(Rect.y + Rect.Hgt, Height);
+	for (int32_t y = std::max<int32_t>(Rect.y, 0); y < iY2; y++)
+		for (int32_t x = std::max<int32_t>(Rect.x, 0); x < iX2; x++)
+			SetPlanes(x, y, Pix2Planes[_GetPix(x, y)]);
+}
+
+void C4Landscape::SetPlanes(int32_t x, int32_t y, uint8_t byPlanes)
+{
+	const size_t iWord = y * PlanePitch + x / 64;
+	const uint64_t iBit = uint64_t(1) << (x % 64);
+	if (byPlanes & C4LS_PlaneSolid) SolidPlane[iWord] |= iBit; else SolidPlane[iWord] &= ~iBit;
+	if (byPlanes & C4LS_PlaneLiquid) LiquidPlane[iWord] |= iBit; else LiquidPlane[iWord] &= ~iBit;
+}
+
+int32_t C4Landscape::GetDensityPlanes(int32_t iDensityMin, int32_t iDensityMax)
+{
+	// find the combination of planes that contains exactly the pixels with a density in range
+	bool fMatches[4] = { true, true, true, true };
+	for (const int32_t iDensity : PlaneDensities)
+	{
+		const bool fHit = Inside(iDensity, iDensityMin, iDensityMax);
+		const uint8_t byPlanes = (DensitySolid(iDensity) ? C4LS_PlaneSolid : 0) | (DensityLiquid(iDensity) ? C4LS_PlaneLiquid : 0);
+		for (int32_t i = 0; i < 4; i++)
+			if (fHit != !!(byPlanes & i)) fMatches[i] = false;
+	}
+	for (int32_t i = 0; i < 4; i++)
+		if (fMatches[i]) return i;
+	return -1;
+}
+
+namespace
+{
+	// bits of word iWord that lie within [x, x2)
+	inline uint64_t PlaneSpanMask(int32_t iWord, int32_t x, int32_t x2)
+	{
+		uint64_t iMask = ~uint64_t(0);
+		if (x > iWord * 64) iMask <<= x - iWord * 64;
+		if (x2 < iWord * 64 + 64) iMask &= ~uint64_t(0) >> (iWord * 64 + 64 - x2);
+		return iMask;
+	}
+}
+
+int32_t C4Landscape::CountInPlanes(uint8_t byPlanes, int32_t x, int32_t y, int32_t wdt)
+{
+	if (wdt <= 0) return 0;
+	const int32_t iEnd = x + wdt;
+	int32_t iCount = 0;
+	// parts left and right of the landscape
+	if (x < 0)
+	{
+		if (Pix2Planes[GetPix(-1, y)] & byPlanes) iCount += std::min<int32_t>(iEnd, 0) - x;
+		x = 0;
+	}
+	if (iEnd > Width && (Pix2Planes[GetPix(Width, y)] & byPlanes)) iCount += iEnd - std::max<int32_t>(x, Width);
+	const int32_t x2 = std::min<int32_t>(iEnd, Width);
+	if (x >= x2) return iCount;
+	// rows above and below the landscape are uniform
+	if (y < 0 || y >= Height) return iCount + ((Pix2Planes[GetPix(x, y)] & byPlanes) ? x2 - x : 0);
+	const uint64_t *pSolid = SolidPlane.data() + y * PlanePitch, *pLiquid = LiquidPlane.data() + y * PlanePitch;
+	for (int32_t iWord = x / 64; iWord * 64 < x2; iWord++)
+	{
+		const uint64_t iBits = ((byPlanes & C4LS_PlaneSolid) ? pSolid[iWord] : 0) | ((byPlanes & C4LS_PlaneLiquid) ? pLiquid[iWord] : 0);
+		iCount += BitCount64(iBits & PlaneSpanMask(iWord, x, x2));
+	}
+	return iCount;
+}
+
+bool C4Landscape::FindInPlanes(uint8_t byPlanes, int32_t x, int32_t y, int32_t wdt, int32_t &rX)
+{
+	if (wdt <= 0) return false;
+	const int32_t iEnd = x + wdt;
+	// part left of the landscape
+	if (x < 0)
+	{
+		if (Pix2Planes[GetPix(-1, y)] & byPlanes) { rX = x; return true; }
+		x = 0;
+	}
+	const int32_t x2 = std::min<int32_t>(iEnd, Width);
+	if (x < x2)
+	{
+		// rows above and below the landscape are uniform
+		if (y < 0 || y >= Height)
+		{
+			if (Pix2Planes[GetPix(x, y)] & byPlanes) { rX = x; return true; }
+		}
+		else
+		{
+			const uint64_t *pSolid = SolidPlane.data() + y * PlanePitch, *pLiquid = LiquidPlane.data() + y * PlanePitch;
+			for (int32_t iWord = x / 64; iWord * 64 < x2; iWord++)
+			{
+				const uint64_t iBits = ((byPlanes & C4LS_PlaneSolid) ? pSolid[iWord] : 0) | ((byPlanes & C4LS_PlaneLiquid) ? pLiquid[iWord] : 0);
+				if (const uint64_t iHits = iBits & PlaneSpanMask(iWord, x, x2))
+				{
+					rX = iWord * 64 + LowestBit64(iHits);
+					return true;
+				}
+			}
+		}
+	}
+	// part right of the landscape
+	if (iEnd > Width && (Pix2Planes[GetPix(Width, y)] & byPlanes))
+	{
+		rX = std::max<int32_t>(x, Width);
+		return true;
+	}
+	return false;
+}
+
+void C4Landscape::InitScanCounts()
+{
+	// count only materials that may be converted by ExecuteScan
+	ScanMatNum = 0;
+	std::fill_n(Mat2ScanIndex, C4MaxMaterial, -1);
+	for (int32_t mat = 0; mat < Game.Material.Num; mat++)
+		if (Game.Material.Map[mat].BelowTempConvertTo || Game.Material.Map[mat].AboveTempConvertTo)
+			Mat2ScanIndex[mat] = ScanMatNum++;
+	ScanColCount.assign(Width * ScanMatNum, 0);
+	if (!ScanMatNum) return;
+	for (int32_t x = 0; x < Width; x++)
+		for (int32_t y = 0; y < Height; y++)
+			CountScanPix(x, _GetMat(x, y), +1);
+}
+
+void C4Landscape::SetScanColumnSkip(bool fSkip)
+{
+	if (fSkip)
+	{
+		if (ScanColCount.empty()) InitScanCounts();
+		return;
+	}
+	// without counts, nothing is counted and ExecuteScan does not skip columns
+	ScanColCount.clear();
+	std::fill_n(Mat2ScanIndex, C4MaxMaterial, -1);
+	ScanMatNum = 0;
+}
+
 void C4Landscape::UpdateMatCnt(C4Rect Rect, bool fPlus)
 {
 	Rect.Intersect(C4Rect(0, 0, Width, Height));
@@ -2818,6 +3134,7 @@ void C4Landscape::UpdateMatCnt(C4Rect Rect, bool fPlus)
 				{
 					// Normal material counting
 					MatCount[iMat] += iMul * (iHgt + 1);
+					CountScanPix(Rect.x + x, iMat, iMul * (iHgt + 1));
 					// Effective material counting enabled?
 					if (int32_t iMinHgt = Game.Material.Map[iMat].MinHeightCount)
 					{
@@ -2844,6 +3161,7 @@ void C4Landscape::UpdateMatCnt(C4Rect Rect, bool fPlus)
 		{
 			// Normal material counting
 			MatCount[iMat] += iMul * (iHgt + 1);
+			CountScanPix(Rect.x + x, iMat, iMul * (iHgt + 1));
 			// Minimum height counting?
 			if (int32_t iMinHgt = Game.Material.Map[iMat].MinHeightCount)
 			{
@@ -23,6 +23,8 @@
 
 #include <StdSurface8.h>
 
+#include <vector>
+
 const uint8_t GBM        = 128,
               GBM_ColNum = 64,
               IFT        = 0x80,
@@ -37,7 +39,11 @@ const int32_t C4LSC_Undefined = 0,
               C4LSC_Static = 2,
               C4LSC_Exact = 3;
 
-const int32_t C4LS_MaxRelights = 50;
+const int32_t C4LS_RelightTileSize = 32; // changed pixels are relit in tiles of this edge length
+
+// density bitplanes of the landscape
+const uint8_t C4LS_PlaneSolid  = 1, // DensitySolid
+              C4LS_PlaneLiquid = 2; // DensityLiquid
 
 class C4MapCreatorS2;
 
@@ -71,9 +77,18 @@ protected:
 	CSurface *AnimationSurface;
 	CSurface8 *Surface8;
 	int32_t Pix2Mat[256], Pix2Dens[256], Pix2Place[256];
+	uint8_t Pix2Planes[256];
+	std::vector<int32_t> PlaneDensities; // distinct densities of all pixel colors
 	int32_t PixCntPitch;
 	uint8_t *PixCnt;
-	C4Rect Relights[C4LS_MaxRelights];
+	std::vector<uint64_t> SolidPlane, LiquidPlane; // one bit per pixel; rows of PlanePitch words
+	int32_t PlanePitch;
+	int32_t Mat2ScanIndex[C4MaxMaterial]; // column count index of materials with temperature conversion; -1 for others
+	int32_t ScanMatNum; // number of materials with temperature conversion
+	std::vector<int32_t> ScanColCount; // pixels of these materials in each column; ScanMatNum entries per column
+	std::vector<bool> RelightTiles; // tiles containing changed pixels
+	int32_t RelightTilesWdt, RelightTilesHgt;
+	bool fRelightsPending;
 
 public:
 	void Default();
@@ -180,6 +195,27 @@ public:
 	}
 
 	inline int32_t GetPixMat(uint8_t byPix) { return Pix2Mat[byPix]; }
+
+	// density bitplane queries
+	// Planes are combinations of C4LS_Plane*; pixels outside the landscape are treated like GetPix does.
+	int32_t GetDensityPlanes(int32_t iDensityMin, int32_t iDensityMax); // planes hit exactly by densities in [min, max]; -1 if there are none
+	inline bool _InPlanes(uint8_t byPlanes, int32_t x, int32_t y) // bounds not checked
+	{
+		const size_t iWord = y * PlanePitch + x / 64;
+		const uint64_t iBit = uint64_t(1) << (x % 64);
+		return ((byPlanes & C4LS_PlaneSolid) && (SolidPlane[iWord] & iBit)) || ((byPlanes & C4LS_PlaneLiquid) && (LiquidPlane[iWord] & iBit));
+	}
+	inline bool InPlanes(uint8_t byPlanes, int32_t x, int32_t y) // bounds checked
+	{
+		if (x < 0 || y < 0 || x >= Width || y >= Height) return !!(Pix2Planes[GetPix(x, y)] & byPlanes);
+		return _InPlanes(byPlanes, x, y);
+	}
+	inline bool InDensityRange(int32_t iPlanes, int32_t iDensityMin, int32_t iDensityMax, int32_t x, int32_t y) // iPlanes from GetDensityPlanes
+	{
+		return iPlanes >= 0 ? InPlanes(iPlanes, x, y) : Inside(GetDensity(x, y), iDensityMin, iDensityMax);
+	}
+	int32_t CountInPlanes(uint8_t byPlanes, int32_t x, int32_t y, int32_t wdt); // number of pixels in [x, x + wdt) of row y
+	bool FindInPlanes(uint8_t byPlanes, int32_t x, int32_t y, int32_t wdt, int32_t &rX); // first pixel in [x, x + wdt) of row y
 	bool _PathFree(int32_t x, int32_t y, int32_t x2, int32_t y2); // quickly checks wether there *might* be pixel in the path.
 	int32_t GetMatHeight(int32_t x, int32_t y, int32_t iYDir, int32_t iMat, int32_t iMax);
 	int32_t DigFreePix(int32_t tx, int32_t ty);
@@ -205,14 +241,15 @@ public:
 	void UpdatePixMaps();
 	bool DoRelights();
 	void RemoveUnusedTexMapEntries();
+	void SetScanColumnSkip(bool fSkip); // false: ExecuteScan scans all columns, like before column counts were kept
 
 protected:
 	void ExecuteScan();
 	int32_t DoScan(int32_t x, int32_t y, int32_t mat, int32_t dir);
 	int32_t ChunkyRandom(int32_t &iOffset, int32_t iRange); // return static random value, according to offset and MapSeed
-	void DrawChunk(int32_t tx, int32_t ty, int32_t wdt, int32_t hgt, int32_t mcol, int32_t iChunkType, int32_t cro);
-	void DrawSmoothOChunk(int32_t tx, int32_t ty, int32_t wdt, int32_t hgt, int32_t mcol, uint8_t flip, int32_t cro);
-	void ChunkOZoom(CSurface8 *sfcMap, int32_t iMapX, int32_t iMapY, int32_t iMapWdt, int32_t iMapHgt, int32_t iTexture, int32_t iOffX = 0, int32_t iOffY = 0);
+	void DrawChunk(CSurface8 *sfcTarget, int32_t tx, int32_t ty, int32_t wdt, int32_t hgt, int32_t mcol, int32_t iChunkType, int32_t cro);
+	void DrawSmoothOChunk(CSurface8 *sfcTarget, int32_t tx, int32_t ty, int32_t wdt, int32_t hgt, int32_t mcol, uint8_t flip, int32_t cro);
+	void ChunkOZoom(CSurface8 *sfcTarget, CSurface8 *sfcMap, int32_t iMapX, int32_t iMapY, int32_t iMapWdt, int32_t iMapHgt, int32_t iTexture, int32_t iOffX = 0, int32_t iOffY = 0);
 	bool GetTexUsage(CSurface8 *sfcMap, int32_t iMapX, int32_t iMapY, int32_t iMapWdt, int32_t iMapHgt, uint32_t *dwpTextureUsage);
 	bool TexOZoom(CSurface8 *sfcMap, int32_t iMapX, int32_t iMapY, int32_t iMapWdt, int32_t iMapHgt, uint32_t *dwpTextureUsage, int32_t iToX = 0, int32_t iToY = 0);
 	bool MapToSurface(CSurface8 *sfcMap, int32_t iMapX, int32_t iMapY, int32_t iMapWdt, int32_t iMapHgt, int32_t iToX, int32_t iToY, int32_t iToWdt, int32_t iToHgt, int32_t iOffX, int32_t iOffY);
@@ -221,6 +258,8 @@ protected:
 	bool SkyToLandscape(int32_t iToX, int32_t iToY, int32_t iToWdt, int32_t iToHgt, int32_t iOffX, int32_t iOffY);
 	CSurface8 *CreateMap(); // create map by landscape attributes
 	CSurface8 *CreateMapS2(C4Group &ScenFile); // create map by def file
+	void InitRelights();
+	void AddRelight(int32_t x, int32_t y);
 	bool Relight(C4Rect To);
 	bool ApplyLighting(C4Rect To);
 	uint32_t GetClrByTex(int32_t iX, int32_t iY);
@@ -233,6 +272,14 @@ protected:
 	}
 
 	void UpdatePixCnt(const class C4Rect &Rect, bool fCheck = false);
+	void InitPlanes();
+	void UpdatePlanes(const class C4Rect &Rect);
+	void SetPlanes(int32_t x, int32_t y, uint8_t byPlanes);
+	void InitScanCounts();
+	void CountScanPix(int32_t x, int32_t mat, int32_t iChange)
+	{
+		if (mat >= 0 && Mat2ScanIndex[mat] >= 0) ScanColCount[x * ScanMatNum + Mat2ScanIndex[mat]] += iChange;
+	}
 	void UpdateMatCnt(C4Rect Rect, bool fPlus);
 	void PrepareChange(C4Rect BoundingBox, bool updateMatCnt = true);
 	void FinishChange(C4Rect BoundingBox, bool updateMatAndPixCnt = true);
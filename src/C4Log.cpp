@@ -284,3 +284,33 @@ bool GetLogSection(size_t iStart, size_t iLength, StdStrBuf &rsOut)
 	// done, success
 	return true;
 }
+
+StdStrBuf StdCompilerWarnMessage(const char *szName, const char *szPosition, const char *szError)
+{
+	if (!szPosition || !*szPosition)
+		return FormatString("WARNING: %s (in %s)", szError, szName);
+	else
+		return FormatString("WARNING: %s (in %s, %s)", szError, szPosition, szName);
+}
+
+StdStrBuf StdCompilerErrorMessage(const char *szName, const StdCompiler::Exception &Exc)
+{
+	if (!Exc.Pos.getLength())
+		return FormatString("ERROR: %s (in %s)", Exc.Msg.getData(), szName);
+	else
+		return FormatString("ERROR: %s (in %s, %s)", Exc.Msg.getData(), Exc.Pos.getData(), szName);
+}
+
+void StdCompilerMessages::Log()
+{
+	for (const auto &Warning : Warnings)
+		DebugLog(Warning.c_str());
+	if (!Error.empty()) ::Log(Error.c_str());
+	Warnings.clear(); Error.clear();
+}
+
+void StdCompilerMessages::WarnCallback(void *pData, const char *szPosition, const char *szError)
+{
+	StdCompilerMessages *pMessages = reinterpret_cast<StdCompilerMessages *>(pData);
+	pMessages->Warnings.push_back(StdCompilerWarnMessage(pMessages->Name.c_str(), szPosition, szError).getData());
+}
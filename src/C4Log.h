@@ -21,6 +21,9 @@
 #include <StdBuf.h>
 #include <StdCompiler.h>
 
+#include <string>
+#include <vector>
+
 bool OpenLog();
 bool CloseLog();
 bool DebugLog(const char *strMessage);
@@ -35,3 +38,18 @@ bool GetLogSection(size_t iStart, size_t iLength, StdStrBuf &rsOut); // re-read
 
 // Used to print a backtrace after a crash
 int GetLogFD();
+
+// Log messages of StdCompiler
+StdStrBuf StdCompilerWarnMessage(const char *szName, const char *szPosition, const char *szError);
+StdStrBuf StdCompilerErrorMessage(const char *szName, const StdCompiler::Exception &Exc);
+
+// Compiler log output that is collected on any thread and logged later by the main thread
+struct StdCompilerMessages
+{
+	std::string Name;
+	std::vector<std::string> Warnings;
+	std::string Error;
+
+	void Log(); // log and clear messages
+	static void WarnCallback(void *pData, const char *szPosition, const char *szError);
+};
@@ -22,6 +22,7 @@
 #include <C4Random.h>
 #include <C4Material.h>
 #include <C4Game.h>
+#include <C4Profiler.h>
 #include <C4Wrappers.h>
 
 // Note: creation optimized using advancing CreatePtr, so sequential
@@ -34,6 +35,10 @@
 // a mathematical triangular shape with no delays! Since masses are
 // running slower and smoother, overall MM counts are much lower,
 // hardly ever exceeding 1000. October 1997
+//
+// Slots are scanned through a bitmap of used ones, so the execution
+// order stays the same while empty slots cost next to nothing. When
+// all slots are used, another chunk of slots is added.
 
 C4MassMoverSet::C4MassMoverSet()
 {
@@ -49,43 +54,94 @@ void C4MassMoverSet::Clear() {}
 
 void C4MassMoverSet::Execute()
 {
-	C4MassMover *cmm;
-	// Init counts
-	Count = 0;
-	// Execute & count
+	// Execute in descending slot order; slots are looked up anew after each mover,
+	// because movers may create others
 	for (int32_t speed = 2; speed > 0; speed--)
-	{
-		cmm = &(Set[C4MassMoverChunk - 1]);
-		for (int32_t cnt = 0; cnt < C4MassMoverChunk; cnt++, cmm--)
-			if (cmm->Mat != MNone)
-			{
-				Count++; cmm->Execute();
-			}
-	}
+		for (int32_t iSlot = FindUsedBelow(GetCapacity()); iSlot >= 0; iSlot = FindUsedBelow(iSlot))
+		{
+			C4MassMover &rMover = GetSlot(iSlot);
+			rMover.Execute();
+			if (rMover.Mat == MNone) SetUsed(iSlot, false);
+		}
+	C4Profiler::Counter("Mass movers", Count);
 }
 
 bool C4MassMoverSet::Create(int32_t x, int32_t y, bool fExecute)
 {
-	if (Count == C4MassMoverChunk) return false;
 #ifdef DEBUGREC
 	C4RCMassMover rc;
 	rc.x = x; rc.y = y;
 	AddDbgRec(RCT_MMC, &rc, sizeof(rc));
 #endif
-	int32_t cptr = CreatePtr;
-	do
+	// next free slot after CreatePtr, wrapping around
+	int32_t cptr = FindFree(CreatePtr + 1, GetCapacity());
+	if (cptr < 0) cptr = FindFree(0, CreatePtr + 1);
+	// all used: add slots
+	if (cptr < 0)
 	{
-		cptr++;
-		if (cptr >= C4MassMoverChunk) cptr = 0;
-		if (Set[cptr].Mat == MNone)
-		{
-			if (!Set[cptr].Init(x, y)) return false;
-			CreatePtr = cptr;
-			if (fExecute) Set[cptr].Execute();
-			return true;
-		}
-	} while (cptr != CreatePtr);
-	return false;
+		cptr = GetCapacity();
+		SetCapacity(static_cast<int32_t>(Chunks.size()) + 1);
+	}
+	C4MassMover &rMover = GetSlot(cptr);
+	if (!rMover.Init(x, y)) return false;
+	CreatePtr = cptr;
+	SetUsed(cptr, true);
+	Count++;
+	if (fExecute)
+	{
+		rMover.Execute();
+		if (rMover.Mat == MNone) SetUsed(cptr, false);
+	}
+	return true;
+}
+
+void C4MassMoverSet::SetCapacity(int32_t iChunkCount)
+{
+	const size_t iOldCount = Chunks.size();
+	Chunks.resize(iChunkCount);
+	for (size_t i = iOldCount; i < Chunks.size(); i++)
+	{
+		Chunks[i].reset(new C4MassMover[C4MassMoverChunk]);
+		for (int32_t cnt = 0; cnt < C4MassMoverChunk; cnt++) Chunks[i][cnt].Mat = MNone;
+	}
+	Used.resize((GetCapacity() + 63) / 64, 0);
+}
+
+void C4MassMoverSet::SetUsed(int32_t iSlot, bool fUsed)
+{
+	const uint64_t iBit = uint64_t(1) << (iSlot % 64);
+	if (fUsed) Used[iSlot / 64] |= iBit; else Used[iSlot / 64] &= ~iBit;
+}
+
+int32_t C4MassMoverSet::FindUsedBelow(int32_t iSlot)
+{
+	if (iSlot <= 0) return -1;
+	int32_t iWord = (iSlot - 1) / 64;
+	// ignore bits at and above iSlot in the first word
+	uint64_t iBits = Used[iWord] & (~uint64_t(0) >> (63 - (iSlot - 1) % 64));
+	while (!iBits)
+	{
+		if (--iWord < 0) return -1;
+		iBits = Used[iWord];
+	}
+	// highest set bit
+	int32_t iBit = 63;
+	while (!(iBits >> iBit)) --iBit;
+	return iWord * 64 + iBit;
+}
+
+int32_t C4MassMoverSet::FindFree(int32_t iFrom, int32_t iTo)
+{
+	iTo = (std::min)(iTo, GetCapacity());
+	for (int32_t iWord = iFrom / 64; iWord * 64 < iTo; iWord++)
+	{
+		uint64_t iFree = ~Used[iWord];
+		if (iWord == iFrom / 64) iFree &= ~uint64_t(0) << (iFrom % 64);
+		if (!iFree) continue;
+		const int32_t iSlot = iWord * 64 + LowestBit64(iFree);
+		return iSlot < iTo ? iSlot : -1;
+	}
+	return -1;
 }
 
 bool C4MassMover::Init(int32_t tx, int32_t ty)
@@ -96,7 +152,6 @@ bool C4MassMover::Init(int32_t tx, int32_t ty)
 	// Check mat
 	Mat = GBackMat(tx, ty);
 	x = tx; y = ty;
-	Game.MassMover.Count++;
 	return (Mat != MNone);
 }
 
@@ -172,22 +227,16 @@ bool C4MassMover::Corrosion(int32_t dx, int32_t dy)
 
 void C4MassMoverSet::Default()
 {
-	int32_t cnt;
-	for (cnt = 0; cnt < C4MassMoverChunk; cnt++) Set[cnt].Mat = MNone;
+	Chunks.clear(); Used.clear();
+	SetCapacity(1);
 	Count = 0;
 	CreatePtr = 0;
 }
 
 bool C4MassMoverSet::Save(C4Group &hGroup)
 {
-	int32_t cnt;
-	// Consolidate
+	// Consolidate, so the used slots are the first Count ones
 	Consolidate();
-	// Recount
-	Count = 0;
-	for (cnt = 0; cnt < C4MassMoverChunk; cnt++)
-		if (Set[cnt].Mat != MNone)
-			Count++;
 	// All empty: delete component
 	if (!Count)
 	{
@@ -195,7 +244,11 @@ bool C4MassMoverSet::Save(C4Group &hGroup)
 		return true;
 	}
 	// Save set
-	if (!hGroup.Add(C4CFN_MassMover, Set, Count * sizeof(C4MassMover)))
+	StdBuf Buf;
+	Buf.New(Count * sizeof(C4MassMover));
+	C4MassMover *pMovers = static_cast<C4MassMover *>(Buf.getMData());
+	for (int32_t cnt = 0; cnt < Count; cnt++) pMovers[cnt] = GetSlot(cnt);
+	if (!hGroup.Add(C4CFN_MassMover, Buf, false, true))
 		return false;
 	// Success
 	return true;
@@ -211,37 +264,36 @@ bool C4MassMoverSet::Load(C4Group &hGroup)
 	if ((iBinSize % iMoverSize) != 0) return false;
 
 	// load new
-	Count = iBinSize / iMoverSize;
-	if (!hGroup.Read(Set, iBinSize)) return false;
+	const int32_t iCount = iBinSize / iMoverSize;
+	std::vector<C4MassMover> Movers(iCount);
+	if (!hGroup.Read(Movers.data(), iBinSize)) return false;
+	SetCapacity((std::max)((iCount + C4MassMoverChunk - 1) / C4MassMoverChunk, 1));
+	for (int32_t cnt = 0; cnt < iCount; cnt++)
+	{
+		GetSlot(cnt) = Movers[cnt];
+		if (Movers[cnt].Mat != MNone) { SetUsed(cnt, true); Count++; }
+	}
 	return true;
 }
 
 void C4MassMoverSet::Consolidate()
 {
-	// Consolidate set
-	int32_t iSpot, iPtr, iConsolidated;
-	for (iSpot = -1, iPtr = 0, iConsolidated = 0; iPtr < C4MassMoverChunk; iPtr++)
-	{
-		// Empty: set new spot if needed
-		if (Set[iPtr].Mat == MNone)
+	// Move all used slots down, keeping their order
+	int32_t iSpot = 0;
+	for (int32_t iPtr = 0; iPtr < GetCapacity(); iPtr++)
+		if (GetSlot(iPtr).Mat != MNone)
 		{
-			if (iSpot == -1) iSpot = iPtr;
-		}
-		// Full: move down to empty spot if possible
-		else if (iSpot != -1)
-		{
-			// Move to spot
-			Set[iSpot] = Set[iPtr];
-			Set[iPtr].Mat = MNone;
-			iConsolidated++;
-			// Advance empty spot (as far as ptr)
-			for (; iSpot < iPtr; iSpot++)
-				if (Set[iSpot].Mat == MNone)
-					break;
-			// No empty spot below ptr
-			if (iSpot == iPtr) iSpot = -1;
+			if (iPtr != iSpot)
+			{
+				GetSlot(iSpot) = GetSlot(iPtr);
+				GetSlot(iPtr).Mat = MNone;
+			}
+			iSpot++;
 		}
-	}
+	// Rebuild used bits and drop surplus chunks
+	std::fill(Used.begin(), Used.end(), 0);
+	for (Count = 0; Count < iSpot; Count++) SetUsed(Count, true);
+	SetCapacity((std::max)((Count + C4MassMoverChunk - 1) / C4MassMoverChunk, 1));
 	// Reset create ptr
 	CreatePtr = 0;
 }
@@ -254,7 +306,10 @@ void C4MassMoverSet::Synchronize()
 void C4MassMoverSet::Copy(C4MassMoverSet &rSet)
 {
 	Clear();
+	Chunks.clear();
+	SetCapacity(static_cast<int32_t>(rSet.Chunks.size()));
+	for (int32_t cnt = 0; cnt < GetCapacity(); cnt++) GetSlot(cnt) = rSet.GetSlot(cnt);
+	Used = rSet.Used;
 	Count = rSet.Count;
 	CreatePtr = rSet.CreatePtr;
-	for (int32_t cnt = 0; cnt < C4MassMoverChunk; cnt++) Set[cnt] = rSet.Set[cnt];
 }
@@ -18,7 +18,10 @@
 
 #pragma once
 
-const int32_t C4MassMoverChunk = 10000;
+#include <memory>
+#include <vector>
+
+const int32_t C4MassMoverChunk = 10000; // slots are allocated in chunks of this size
 
 class C4MassMoverSet;
 
@@ -43,11 +46,14 @@ public:
 	~C4MassMoverSet();
 
 public:
-	int32_t Count;
+	int32_t Count; // number of active movers
 	int32_t CreatePtr;
 
 protected:
-	C4MassMover Set[C4MassMoverChunk];
+	// Movers are kept in slots whose index determines the execution order.
+	// Chunks are never moved, so movers stay in place while the set grows.
+	std::vector<std::unique_ptr<C4MassMover[]>> Chunks;
+	std::vector<uint64_t> Used; // one bit per slot that holds an active mover
 
 public:
 	void Copy(C4MassMoverSet &rSet);
@@ -61,4 +67,10 @@ public:
 
 protected:
 	void Consolidate();
+	int32_t GetCapacity() const { return static_cast<int32_t>(Chunks.size()) * C4MassMoverChunk; }
+	C4MassMover &GetSlot(int32_t iSlot) { return Chunks[iSlot / C4MassMoverChunk][iSlot % C4MassMoverChunk]; }
+	void SetCapacity(int32_t iChunkCount); // slots beyond the new capacity must be unused
+	void SetUsed(int32_t iSlot, bool fUsed);
+	int32_t FindUsedBelow(int32_t iSlot); // highest used slot below iSlot; -1 if none
+	int32_t FindFree(int32_t iFrom, int32_t iTo); // lowest unused slot in [iFrom, iTo); -1 if none
 };
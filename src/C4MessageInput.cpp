@@ -29,6 +29,7 @@
 #include <C4Network2Dialogs.h>
 #include <C4Log.h>
 #include <C4Player.h>
+#include <C4Profiler.h>
 #include <C4GameLobby.h>
 
 // C4ChatInputDialog
@@ -571,6 +572,26 @@ bool C4MessageInput::ProcessCommand(const char *szCommand)
 		Application.NextTick(false);
 		return true;
 	}
+	// toggle profiler trace; writes the trace when stopped
+	if (SEqual(szCmdName, "trace"))
+	{
+		if (!C4Profiler::IsEnabled())
+		{
+			C4Profiler::Clear();
+			C4Profiler::Enable(true);
+			Log("Profiler trace started.");
+			return true;
+		}
+		C4Profiler::Enable(false);
+		const char *szFilename = *pCmdPar ? pCmdPar : "Trace.json";
+		if (!C4Profiler::ExportTrace(szFilename))
+		{
+			LogF("Could not write profiler trace to %s", szFilename);
+			return false;
+		}
+		LogF("Profiler trace written to %s", szFilename);
+		return true;
+	}
 	// reset fast mode
 	if (SEqual(szCmdName, "slow"))
 	{
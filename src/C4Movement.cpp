@@ -453,9 +453,9 @@ void C4Object::DoMovement()
 	if (fAnyContact)
 	{
 		C4AulParSet pars(C4VInt(fixtoi(oldxdir, 100)), C4VInt(fixtoi(oldydir, 100)));
-		if (old_ocf & OCF_HitSpeed1) Call(PSF_Hit,  &pars);
-		if (old_ocf & OCF_HitSpeed2) Call(PSF_Hit2, &pars);
-		if (old_ocf & OCF_HitSpeed3) Call(PSF_Hit3, &pars);
+		if (old_ocf & OCF_HitSpeed1) Call(OCB_Hit,  &pars);
+		if (old_ocf & OCF_HitSpeed2) Call(OCB_Hit2, &pars);
+		if (old_ocf & OCF_HitSpeed3) Call(OCB_Hit3, &pars);
 	}
 
 	// Rotation gfx
@@ -601,6 +601,7 @@ bool SimFlight(FIXED &x, FIXED &y, FIXED &xdir, FIXED &ydir, int32_t iDensityMin
 	bool fBreak = false;
 	int32_t ctcox, ctcoy, cx, cy;
 	cx = fixtoi(x); cy = fixtoi(y);
+	const int32_t iPlanes = Game.Landscape.GetDensityPlanes(iDensityMin, iDensityMax);
 	do
 	{
 		if (!iIter--) return false;
@@ -616,7 +617,7 @@ bool SimFlight(FIXED &x, FIXED &y, FIXED &xdir, FIXED &ydir, int32_t iDensityMin
 			// Set next step target
 			cx += Sign(ctcox - cx); cy += Sign(ctcoy - cy);
 			// Contact check
-			if (Inside(GBackDensity(cx, cy), iDensityMin, iDensityMax))
+			if (Game.Landscape.InDensityRange(iPlanes, iDensityMin, iDensityMax, cx, cy))
 			{
 				fBreak = true; break;
 			}
@@ -250,11 +250,11 @@ void C4Object::AssignRemoval(bool fExitContents)
 	if (Contained)
 	{
 		C4AulParSet pars(C4VObj(this));
-		Contained->Call(PSF_ContentsDestruction, &pars);
+		Contained->Call(OCB_ContentsDestruction, &pars);
 		if (!Status) return;
 	}
 	// Destruction call
-	Call(PSF_Destruction);
+	Call(OCB_Destruction);
 	// Destruction-callback might have deleted the object already
 	if (!Status) return;
 	// remove all effects (extinguishes as well)
@@ -907,7 +907,7 @@ bool C4Object::ExecLife()
 				// Take breath
 				int32_t takebreath = GetPhysical()->Breath - Breath;
 				if (takebreath > GetPhysical()->Breath / 2)
-					Call(PSF_DeepBreath);
+					Call(OCB_DeepBreath);
 				Breath += takebreath;
 			}
 		}
@@ -1155,7 +1155,7 @@ void C4Object::AssignDeath(bool fForced)
 		SetPlrViewRange(0);
 	// Engine script call
 	C4AulParSet pars(C4VInt(iDeathCausingPlayer));
-	Call(PSF_Death, &pars);
+	Call(OCB_Death, &pars);
 	// Update OCF. Done here because previously it would have been done in the next frame
 	// Whats worse: Having the OCF change because of some unrelated script-call like
 	// SetCategory, or slightly breaking compatibility?
@@ -1187,6 +1187,7 @@ bool C4Object::ChangeDef(C4ID idNew)
 	LocalNamed.SetNameList(&pDef->Script.LocalNamed);
 	// new def: Needs to be resorted
 	Unsorted = true;
+	Game.Objects.UpdateTypeIndex(this);
 	// graphics change
 	pGraphics = &pDef->Graphics;
 	// blit mode adjustment
@@ -1272,7 +1273,7 @@ void C4Object::DoDamage(int32_t iChange, int32_t iCausedBy, int32_t iCause)
 	// Change value
 	Damage = std::max<int32_t>(Damage + iChange, 0);
 	// Engine script call
-	Call(PSF_Damage, &C4AulParSet(C4VInt(iChange), C4VInt(iCausedBy)));
+	Call(OCB_Damage, &C4AulParSet(C4VInt(iChange), C4VInt(iCausedBy)));
 }
 
 // returns x * y, but returns std::numeric_limits<T>::min() or std::numeric_limits<T>::max() in case of a negative or positive overflow respectively
@@ -1466,8 +1467,8 @@ void C4Object::DoCon(int32_t iChange, bool fInitial, bool fNoComponentChange)
 	// Completion (after bottom y-adjust for correct position)
 	if (!fWasFull && (Con >= FullCon))
 	{
-		Call(PSF_Completion);
-		Call(PSF_Initialize);
+		Call(OCB_Completion);
+		Call(OCB_Initialize);
 	}
 
 	// Con Zero Removal
@@ -1517,8 +1518,8 @@ bool C4Object::Exit(int32_t iX, int32_t iY, int32_t iR, FIXED iXDir, FIXED iYDir
 	UpdateFace(true);
 	SetOCF();
 	// Engine calls
-	if (fCalls) pContainer->Call(PSF_Ejection, &C4AulParSet(C4VObj(this)));
-	if (fCalls) Call(PSF_Departure, &C4AulParSet(C4VObj(pContainer)));
+	if (fCalls) pContainer->Call(OCB_Ejection, &C4AulParSet(C4VObj(this)));
+	if (fCalls) Call(OCB_Departure, &C4AulParSet(C4VObj(pContainer)));
 	// Success (if the obj wasn't "re-entered" by script)
 	return !Contained;
 }
@@ -1535,14 +1536,14 @@ bool C4Object::Enter(C4Object *pTarget, bool fCalls, bool fCopyMotion, bool *pfR
 	// No target or target is self
 	if (!pTarget || (pTarget == this)) return false;
 	// check if entrance is allowed
-	if (!!Call(PSF_RejectEntrance, &C4AulParSet(C4VObj(pTarget)))) return false;
+	if (!!Call(OCB_RejectEntrance, &C4AulParSet(C4VObj(pTarget)))) return false;
 	// check if we end up in an endless container-recursion
 	for (C4Object *pCnt = pTarget->Contained; pCnt; pCnt = pCnt->Contained)
 		if (pCnt == this) return false;
 	// Check RejectCollect, if desired
 	if (pfRejectCollect)
 	{
-		if (!!pTarget->Call(PSF_RejectCollection, &C4AulParSet(C4VID(Def->id), C4VObj(this))))
+		if (!!pTarget->Call(OCB_RejectCollection, &C4AulParSet(C4VID(Def->id), C4VObj(this))))
 		{
 			*pfRejectCollect = true;
 			return false;
@@ -1583,10 +1584,10 @@ bool C4Object::Enter(C4Object *pTarget, bool fCalls, bool fCopyMotion, bool *pfR
 	Contained->UpdateMass();
 	Contained->SetOCF();
 	// Collection call
-	if (fCalls) pTarget->Call(PSF_Collection2, &C4AulParSet(C4VObj(this)));
+	if (fCalls) pTarget->Call(OCB_Collection2, &C4AulParSet(C4VObj(this)));
 	if (!Contained || !Contained->Status || !pTarget->Status) return true;
 	// Entrance call
-	if (fCalls) Call(PSF_Entrance, &C4AulParSet(C4VObj(Contained)));
+	if (fCalls) Call(OCB_Entrance, &C4AulParSet(C4VObj(Contained)));
 	if (!Contained || !Contained->Status || !pTarget->Status) return true;
 	// Base auto sell contents
 	if (ValidPlr(Contained->Base))
@@ -1624,7 +1625,7 @@ bool C4Object::ActivateEntrance(int32_t by_plr, C4Object *by_obj)
 	}
 	// Try entrance activation
 	if (OCF & OCF_Entrance)
-		if (!!Call(PSF_ActivateEntrance, &C4AulParSet(C4VObj(by_obj))))
+		if (!!Call(OCB_ActivateEntrance, &C4AulParSet(C4VObj(by_obj))))
 			return true;
 	// Failure
 	return false;
@@ -1694,7 +1695,7 @@ bool C4Object::Build(int32_t iLevel, C4Object *pBuilder)
 	if (NeededMaterialCount)
 	{
 		// BuildNeedsMaterial call to builder script...
-		if (!pBuilder->Call(PSF_BuildNeedsMaterial,
+		if (!pBuilder->Call(OCB_BuildNeedsMaterial,
 			&C4AulParSet(C4VID(NeededMaterial), C4VInt(NeededMaterialCount))))
 		{
 			// Builder is a crew member...
@@ -1789,7 +1790,7 @@ bool C4Object::Push(FIXED txdir, FIXED dforce, bool fStraighten)
 		if (ContactCheck(x, y)) // Resets t_contact
 		{
 			GameMsgObject(FormatString(LoadResStr("IDS_OBJ_STUCK"), GetName()).getData(), this);
-			Call(PSF_Stuck);
+			Call(OCB_Stuck);
 		}
 
 	return true;
@@ -1819,7 +1820,7 @@ bool C4Object::Lift(FIXED tydir, FIXED dforce)
 		if (ContactCheck(x, y)) // Resets t_contact
 		{
 			GameMsgObject(FormatString(LoadResStr("IDS_OBJ_STUCK"), GetName()).getData(), this);
-			Call(PSF_Stuck);
+			Call(OCB_Stuck);
 		}
 	return true;
 }
@@ -1864,7 +1865,7 @@ bool C4Object::ActivateMenu(int32_t iMenu, int32_t iMenuSelect,
 		// No target specified: use own container as target
 		if (!pTarget) if (!(pTarget = Contained)) break;
 		// Opening contents menu blocked by RejectContents
-		if (!!pTarget->Call(PSF_RejectContents)) return false;
+		if (!!pTarget->Call(OCB_RejectContents)) return false;
 		// Create symbol
 		fctSymbol.Create(C4SymbolSize, C4SymbolSize);
 		pTarget->Def->Draw(fctSymbol, false, pTarget->Color, pTarget);
@@ -1907,7 +1908,7 @@ bool C4Object::ActivateMenu(int32_t iMenu, int32_t iMenuSelect,
 		// No target specified
 		if (!pTarget) break;
 		// Opening contents menu blocked by RejectContents
-		if (!!pTarget->Call(PSF_RejectContents)) return false;
+		if (!!pTarget->Call(OCB_RejectContents)) return false;
 		// Create symbol & init
 		fctSymbol.Create(C4SymbolSize, C4SymbolSize);
 		pTarget->Def->Draw(fctSymbol, false, pTarget->Color, pTarget);
@@ -2182,6 +2183,16 @@ C4Value C4Object::Call(const char *szFunctionCall, C4AulParSet *pPars, bool fPas
 	return Def->Script.ObjectCall(this, this, szFunctionCall, pPars, fPassError);
 }
 
+C4Value C4Object::Call(C4ObjectCallback eCallback, C4AulParSet *pPars, bool fPassError)
+{
+	if (!Status || !Def) return C4VNull;
+	// function table is only valid while the script is linked
+	if (!Def->Script.IsReady()) return Call(C4ObjectCallbackNames[eCallback], pPars, fPassError);
+	C4AulScriptFunc *pFn = Def->Script.SFn_Callbacks[eCallback];
+	if (!pFn) return C4VNull;
+	return pFn->Exec(this, pPars, fPassError);
+}
+
 bool C4Object::SetPhase(int32_t iPhase)
 {
 	if (Action.Act <= ActIdle) return false;
@@ -3223,7 +3234,7 @@ bool C4Object::ContainedControl(uint8_t byCom)
 				C4VInt(Coms2ComDir(PressedComs)),
 				C4VBool(!!(PressedComs & (1 << COM_Dig))),
 				C4VBool(!!(PressedComs & (1 << COM_Throw))));
-			Contained->Call(PSF_ContainedControlUpdate, &set);
+			Contained->Call(OCB_ContainedControlUpdate, &set);
 		}
 	}
 	if (result) return true;
@@ -3261,7 +3272,7 @@ bool C4Object::ContainedControl(uint8_t byCom)
 				C4VInt(Coms2ComDir(PressedComs)),
 				C4VBool(!!(PressedComs & (1 << COM_Dig))),
 				C4VBool(!!(PressedComs & (1 << COM_Throw))));
-			Contained->Call(PSF_ContainedControlUpdate, &set);
+			Contained->Call(OCB_ContainedControlUpdate, &set);
 		}
 	}
 	// Take/Take2
@@ -3294,7 +3305,7 @@ bool C4Object::CallControl(C4Player *pPlr, uint8_t byCom, C4AulParSet *pPars)
 			C4VBool(!!(PressedComs & (1 << COM_Throw))),
 			C4VBool(!!(PressedComs & (1 << COM_Special))),
 			C4VBool(!!(PressedComs & (1 << COM_Special2))));
-		Call(PSF_ControlUpdate, &set);
+		Call(OCB_ControlUpdate, &set);
 	}
 	return result;
 }
@@ -3731,7 +3742,7 @@ C4Object *C4Object::ComposeContents(C4ID id)
 	if (fInsufficient)
 	{
 		// BuildNeedsMaterial call to object...
-		if (!Call(PSF_BuildNeedsMaterial, &C4AulParSet(C4VID(idNeeded), C4VInt(iNeeded))))
+		if (!Call(OCB_BuildNeedsMaterial, &C4AulParSet(C4VID(idNeeded), C4VInt(iNeeded))))
 			// ...game message if not overloaded
 			GameMsgObject(Needs.getData(), this);
 		// Return
@@ -3891,7 +3902,7 @@ void C4Object::SetCommand(int32_t iCommand, C4Object *pTarget, C4Value iTx, int3
 		if (!CloseMenu(false)) return;
 	// Script overload
 	if (fControl)
-		if (!!Call(PSF_ControlCommand, &C4AulParSet(C4VString(CommandName(iCommand)),
+		if (!!Call(OCB_ControlCommand, &C4AulParSet(C4VString(CommandName(iCommand)),
 			C4VObj(pTarget),
 			iTx,
 			C4VInt(iTy),
@@ -3903,7 +3914,7 @@ void C4Object::SetCommand(int32_t iCommand, C4Object *pTarget, C4Value iTx, int3
 		if (Contained->Def->VehicleControl & C4D_VehicleControl_Inside)
 		{
 			Contained->Controller = Controller;
-			if (!!Contained->Call(PSF_ControlCommand, &C4AulParSet(C4VString(CommandName(iCommand)),
+			if (!!Contained->Call(OCB_ControlCommand, &C4AulParSet(C4VString(CommandName(iCommand)),
 				C4VObj(pTarget),
 				iTx,
 				C4VInt(iTy),
@@ -3917,7 +3928,7 @@ void C4Object::SetCommand(int32_t iCommand, C4Object *pTarget, C4Value iTx, int3
 		if (Action.Target) if (Action.Target->Def->VehicleControl & C4D_VehicleControl_Outside)
 		{
 			Action.Target->Controller = Controller;
-			if (!!Action.Target->Call(PSF_ControlCommand, &C4AulParSet(C4VString(CommandName(iCommand)),
+			if (!!Action.Target->Call(OCB_ControlCommand, &C4AulParSet(C4VString(CommandName(iCommand)),
 				C4VObj(pTarget),
 				iTx,
 				C4VInt(iTy),
@@ -3944,7 +3955,7 @@ bool C4Object::ExecuteCommand()
 	if (Command) Command->Execute();
 	// Command finished: engine call
 	if (Command && Command->Finished)
-		Call(PSF_ControlCommandFinished, &C4AulParSet(C4VString(CommandName(Command->Command)), C4VObj(Command->Target), Command->Tx, C4VInt(Command->Ty), C4VObj(Command->Target2), C4Value(Command->Data, C4V_Any)));
+		Call(OCB_ControlCommandFinished, &C4AulParSet(C4VString(CommandName(Command->Command)), C4VObj(Command->Target), Command->Tx, C4VInt(Command->Ty), C4VObj(Command->Target2), C4Value(Command->Data, C4V_Any)));
 	// Clear finished commands
 	while (Command && Command->Finished) ClearCommand(Command);
 	// Done
@@ -4035,6 +4046,14 @@ void C4Object::DrawCommand(C4Facet &cgoBar, int32_t iAlign, const char *szFuncti
 		pRegions->Add(cgoLeft.X, cgoLeft.Y, cgoLeft.Wdt * 2, cgoLeft.Hgt, cpDesc ? cpDesc : GetName(), iCom);
 }
 
+void C4Object::SetCategory(int32_t Category)
+{
+	this->Category = Category;
+	Resort();
+	Game.Objects.UpdateTypeIndex(this);
+	SetOCF();
+}
+
 void C4Object::Resort()
 {
 	// Flag resort
@@ -4222,7 +4241,7 @@ int32_t C4Object::GetProcedure()
 void GrabLost(C4Object *cObj)
 {
 	// Grab lost script call on target (quite hacky stuff...)
-	cObj->Action.Target->Call(PSF_GrabLost);
+	cObj->Action.Target->Call(OCB_GrabLost);
 	// Clear commands down to first PushTo (if any) in command stack
 	for (C4Command *pCom = cObj->Command; pCom; pCom = pCom->Next)
 		if (pCom->Next && pCom->Next->Command == C4CMD_PushTo)
@@ -5231,7 +5250,7 @@ void C4Object::ExecAction()
 		if (Def->LiftTop)
 			if (Action.Target->y <= (y + Def->LiftTop))
 				if (Action.ComDir == COMD_Up)
-					Call(PSF_LiftTop);
+					Call(OCB_LiftTop);
 		// General
 		DoGravity(this);
 		break;
@@ -5267,7 +5286,7 @@ void C4Object::ExecAction()
 			if (Status)
 			{
 				SetAction(ActIdle);
-				Call(PSF_AttachTargetLost);
+				Call(OCB_AttachTargetLost);
 			}
 			return;
 		}
@@ -5292,7 +5311,7 @@ void C4Object::ExecAction()
 				if (Status)
 				{
 					SetAction(ActIdle);
-					Call(PSF_AttachTargetLost);
+					Call(OCB_AttachTargetLost);
 				}
 				return;
 			}
@@ -5318,7 +5337,7 @@ void C4Object::ExecAction()
 		if (!Action.Target2 || (Action.Target2->Con < FullCon)) fBroke = true;
 		if (fBroke)
 		{
-			Call(PSF_LineBreak, &C4AulParSet(C4VBool(true)));
+			Call(OCB_LineBreak, &C4AulParSet(C4VBool(true)));
 			AssignRemoval();
 			return;
 		}
@@ -5383,7 +5402,7 @@ void C4Object::ExecAction()
 		// Line fBroke
 		if (fBroke)
 		{
-			Call(PSF_LineBreak, 0);
+			Call(OCB_LineBreak, 0);
 			AssignRemoval();
 			return;
 		}
@@ -5476,7 +5495,7 @@ bool C4Object::SetOwner(int32_t iOwner)
 			Action.Target->Base = Owner;
 		}
 	// script callback
-	Call(PSF_OnOwnerChanged, &C4AulParSet(C4VInt(Owner), C4VInt(iOldOwner)));
+	Call(OCB_OnOwnerChanged, &C4AulParSet(C4VInt(Owner), C4VInt(iOldOwner)));
 	// done
 	return true;
 }
@@ -5637,11 +5656,11 @@ bool C4Object::Collect(C4Object *pObj)
 	// Cancel attach (hacky)
 	ObjectComCancelAttach(pObj);
 	// Container Collection call
-	Call(PSF_Collection, &C4AulParSet(C4VObj(pObj)));
+	Call(OCB_Collection, &C4AulParSet(C4VObj(pObj)));
 	// Object Hit call
-	if (pObj->Status && pObj->OCF & OCF_HitSpeed1) pObj->Call(PSF_Hit);
-	if (pObj->Status && pObj->OCF & OCF_HitSpeed2) pObj->Call(PSF_Hit2);
-	if (pObj->Status && pObj->OCF & OCF_HitSpeed3) pObj->Call(PSF_Hit3);
+	if (pObj->Status && pObj->OCF & OCF_HitSpeed1) pObj->Call(OCB_Hit);
+	if (pObj->Status && pObj->OCF & OCF_HitSpeed2) pObj->Call(OCB_Hit2);
+	if (pObj->Status && pObj->OCF & OCF_HitSpeed3) pObj->Call(OCB_Hit3);
 	// post-copy the motion of the new container
 	if (pObj->Contained == this) pObj->CopyMotion(this);
 	// done, success
@@ -5753,7 +5772,7 @@ bool C4Object::DoSelect(bool fCursor)
 	// select
 	if (!fCursor) Select = 1;
 	// do callback
-	Call(PSF_CrewSelection, &C4AulParSet(C4VBool(false), C4VBool(!!fCursor)));
+	Call(OCB_CrewSelection, &C4AulParSet(C4VBool(false), C4VBool(!!fCursor)));
 	// done
 	return true;
 }
@@ -5763,7 +5782,7 @@ void C4Object::UnSelect(bool fCursor)
 	// unselect
 	if (!fCursor) Select = 0;
 	// do callback
-	Call(PSF_CrewSelection, &C4AulParSet(C4VBool(true), C4VBool(!!fCursor)));
+	Call(OCB_CrewSelection, &C4AulParSet(C4VBool(true), C4VBool(!!fCursor)));
 }
 
 void C4Object::GetViewPosPar(int32_t &riX, int32_t &riY, int32_t tx, int32_t ty, const C4Facet &fctViewport)
@@ -5913,7 +5932,7 @@ bool C4Object::StatusActivate()
 	UpdateGraphics(false);
 	UpdateFace(true);
 	UpdatePos();
-	Call(PSF_UpdateTransferZone);
+	Call(OCB_UpdateTransferZone);
 	// done, success
 	return true;
 }
@@ -6046,23 +6065,27 @@ void C4Object::UpdateInLiquid()
 
 void C4Object::AddRef(C4Value *pRef)
 {
-	pRef->NextRef = FirstRef;
+	C4ValueLinks &RefLinks = pRef->GetLinks();
+	RefLinks.NextRef = FirstRef;
+	RefLinks.PrevRef = nullptr;
+	if (FirstRef) FirstRef->Links->PrevRef = pRef;
 	FirstRef = pRef;
 }
 
-void C4Object::DelRef(const C4Value *pRef, C4Value *pNextRef)
+void C4Object::DelRef(const C4Value *pRef, C4Value *pPrevRef, C4Value *pNextRef)
 {
 	// References to objects never have HasBaseArray set
-	if (pRef == FirstRef)
+	if (!pPrevRef)
+	{
+		assert(pRef == FirstRef);
 		FirstRef = pNextRef;
+	}
 	else
 	{
-		C4Value *pVal = FirstRef;
-		while (pVal->NextRef && pVal->NextRef != pRef)
-			pVal = pVal->NextRef;
-		assert(pVal->NextRef);
-		pVal->NextRef = pNextRef;
+		assert(pPrevRef->Links->NextRef == pRef);
+		pPrevRef->Links->NextRef = pNextRef;
 	}
+	if (pNextRef) pNextRef->Links->PrevRef = pPrevRef;
 }
 
 StdStrBuf C4Object::GetInfoString()
@@ -26,6 +26,7 @@
 #include "C4ValueList.h"
 #include "C4Effects.h"
 #include "C4Particles.h"
+#include "C4Script.h"
 
 #include <array>
 
@@ -237,6 +238,7 @@ public:
 
 	bool CallControl(C4Player *pPlr, uint8_t byCom, C4AulParSet *pPars = nullptr);
 	C4Value Call(const char *szFunctionCall, C4AulParSet *pPars = nullptr, bool fPassError = false);
+	C4Value Call(C4ObjectCallback eCallback, C4AulParSet *pPars = nullptr, bool fPassError = false); // engine callback via the function table of the definition
 
 	bool ContainedControl(uint8_t byCom);
 
@@ -307,7 +309,7 @@ public:
 	bool SetAction(int32_t iAct, C4Object *pTarget = nullptr, C4Object *pTarget2 = nullptr, int32_t iCalls = SAC_StartCall | SAC_AbortCall, bool fForce = false);
 	bool SetActionByName(const char *szActName, C4Object *pTarget = nullptr, C4Object *pTarget2 = nullptr, int32_t iCalls = SAC_StartCall | SAC_AbortCall, bool fForce = false);
 	void SetDir(int32_t tdir);
-	void SetCategory(int32_t Category) { this->Category = Category; Resort(); SetOCF(); }
+	void SetCategory(int32_t Category);
 	int32_t GetProcedure();
 	bool Enter(C4Object *pTarget, bool fCalls = true, bool fCopyMotion = true, bool *pfRejectCollect = nullptr);
 	bool Exit(int32_t iX = 0, int32_t iY = 0, int32_t iR = 0, FIXED iXDir = Fix0, FIXED iYDir = Fix0, FIXED iRDir = Fix0, bool fCalls = true);
@@ -419,7 +421,7 @@ public:
 	bool AdjustWalkRotation(int32_t iRangeX, int32_t iRangeY, int32_t iSpeed);
 
 	void AddRef(C4Value *pRef);
-	void DelRef(const C4Value *pRef, C4Value *pNextRef);
+	void DelRef(const C4Value *pRef, C4Value *pPrevRef, C4Value *pNextRef);
 
 	StdStrBuf GetInfoString(); // return def desc plus effects
 
@@ -49,7 +49,7 @@ bool ObjectActionJump(C4Object *cObj, FIXED xdir, FIXED ydir, bool fByCom)
 	// scripted jump?
 	assert(cObj);
 	C4AulParSet pars(C4VInt(fixtoi(xdir, 100)), C4VInt(fixtoi(ydir, 100)), C4VBool(fByCom));
-	if (!!cObj->Call(PSF_OnActionJump, &pars)) return true;
+	if (!!cObj->Call(OCB_OnActionJump, &pars)) return true;
 	// hardcoded jump by action
 	if (!cObj->SetActionByName("Jump")) return false;
 	cObj->xdir = xdir; cObj->ydir = ydir;
@@ -249,11 +249,11 @@ bool ObjectComGrab(C4Object *cObj, C4Object *pTarget)
 	if (!pTarget) return false;
 	if (cObj->GetProcedure() != DFA_WALK) return false;
 	if (!ObjectActionPush(cObj, pTarget)) return false;
-	cObj->Call(PSF_Grab, &C4AulParSet(C4VObj(pTarget), C4VBool(true)));
+	cObj->Call(OCB_Grab, &C4AulParSet(C4VObj(pTarget), C4VBool(true)));
 	if (pTarget->Status && cObj->Status)
 	{
 		pTarget->Controller = cObj->Controller;
-		pTarget->Call(PSF_Grabbed, &C4AulParSet(C4VObj(cObj), C4VBool(true)));
+		pTarget->Call(OCB_Grabbed, &C4AulParSet(C4VObj(cObj), C4VBool(true)));
 	}
 	return true;
 }
@@ -267,9 +267,9 @@ bool ObjectComUnGrab(C4Object *cObj)
 		if (ObjectActionStand(cObj))
 		{
 			if (!cObj->CloseMenu(false)) return false;
-			cObj->Call(PSF_Grab, &C4AulParSet(C4VObj(pTarget), C4VBool(false)));
+			cObj->Call(OCB_Grab, &C4AulParSet(C4VObj(pTarget), C4VBool(false)));
 			if (pTarget && pTarget->Status && cObj->Status)
-				pTarget->Call(PSF_Grabbed, &C4AulParSet(C4VObj(cObj), C4VBool(false)));
+				pTarget->Call(OCB_Grabbed, &C4AulParSet(C4VObj(cObj), C4VBool(false)));
 			return true;
 		}
 	}
@@ -536,7 +536,7 @@ void ObjectComDigDouble(C4Object *cObj) // "Activation" by DFA_WALK, DFA_DIG, DF
 
 	// Contents activation (first contents object only)
 	if (cObj->Contents.GetObject())
-		if (!!cObj->Contents.GetObject()->Call(PSF_Activate, &C4AulParSet(C4VObj(cObj))))
+		if (!!cObj->Contents.GetObject()->Call(OCB_Activate, &C4AulParSet(C4VObj(cObj))))
 			return;
 
 	// Linekit: Line construction (move to linekit script...)
@@ -567,7 +567,7 @@ void ObjectComDigDouble(C4Object *cObj) // "Activation" by DFA_WALK, DFA_DIG, DF
 						return;
 
 	// Own activation call
-	if (!!cObj->Call(PSF_Activate, &C4AulParSet(C4VObj(cObj)))) return;
+	if (!!cObj->Call(OCB_Activate, &C4AulParSet(C4VObj(cObj)))) return;
 }
 
 bool ObjectComDownDouble(C4Object *cObj) // by DFA_WALK
@@ -615,9 +615,9 @@ bool ObjectComPut(C4Object *cObj, C4Object *pTarget, C4Object *pThing)
 	bool fRejectCollect;
 	if (!pThing->Enter(pTarget, true, true, &fRejectCollect)) return false;
 	// Put call to object script
-	cObj->Call(PSF_Put);
+	cObj->Call(OCB_Put);
 	// Target collection call
-	pTarget->Call(PSF_Collection, &C4AulParSet(C4VObj(pThing), C4VBool(true)));
+	pTarget->Call(OCB_Collection, &C4AulParSet(C4VObj(pThing), C4VBool(true)));
 	// Success
 	return true;
 }
@@ -739,7 +739,7 @@ bool ObjectComPunch(C4Object *cObj, C4Object *pTarget, int32_t punch)
 		if (pTarget->GetPhysical()->Fight)
 			punch = BoundBy<int32_t>(5 * cObj->GetPhysical()->Fight / pTarget->GetPhysical()->Fight, 0, 10);
 	if (!punch) return true;
-	bool fBlowStopped = !!pTarget->Call(PSF_QueryCatchBlow, &C4AulParSet(C4VObj(cObj)));
+	bool fBlowStopped = !!pTarget->Call(OCB_QueryCatchBlow, &C4AulParSet(C4VObj(cObj)));
 	if (fBlowStopped && punch > 1) punch = punch / 2; // half damage for caught blow, so shield+armor help in fistfight and vs monsters
 	pTarget->DoEnergy(-punch, false, C4FxCall_EngGetPunched, cObj->Controller);
 	int32_t tdir = +1; if (cObj->Action.Dir == DIR_Left) tdir = -1;
@@ -751,7 +751,7 @@ bool ObjectComPunch(C4Object *cObj, C4Object *pTarget, int32_t punch)
 		if (ObjectActionTumble(pTarget, pTarget->Action.Dir, FIXED100(150) * tdir, itofix(-2)))
 		{
 			pTarget->LastEnergyLossCausePlayer = cObj->Controller; // for kill tracing when pushing enemies off a cliff
-			pTarget->Call(PSF_CatchBlow, &C4AulParSet(C4VInt(punch), C4VObj(cObj)));
+			pTarget->Call(OCB_CatchBlow, &C4AulParSet(C4VInt(punch), C4VObj(cObj)));
 			return true;
 		}
 
@@ -759,7 +759,7 @@ bool ObjectComPunch(C4Object *cObj, C4Object *pTarget, int32_t punch)
 	if (ObjectActionGetPunched(pTarget, FIXED100(250) * tdir, Fix0))
 	{
 		pTarget->LastEnergyLossCausePlayer = cObj->Controller; // for kill tracing when pushing enemies off a cliff
-		pTarget->Call(PSF_CatchBlow, &C4AulParSet(C4VInt(punch), C4VObj(cObj)));
+		pTarget->Call(OCB_CatchBlow, &C4AulParSet(C4VInt(punch), C4VObj(cObj)));
 		return true;
 	}
 
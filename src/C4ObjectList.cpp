@@ -23,6 +23,167 @@
 #include <C4Wrappers.h>
 #include <C4Application.h>
 
+namespace
+{
+	// Object links are allocated from chunks, so the links of lists built together share cache lines
+	// and adding or removing objects does not go through the general purpose allocator.
+	// Chunks are never freed, so links of static lists can be deleted at any time during shutdown.
+	class C4ObjectLinkPool
+	{
+	public:
+		void *Allocate()
+		{
+			if (!pFree) AddChunk();
+			Slot *pSlot = pFree;
+			pFree = pSlot->NextFree;
+			return pSlot;
+		}
+
+		void Free(void *pLink)
+		{
+			Slot *pSlot = static_cast<Slot *>(pLink);
+			pSlot->NextFree = pFree;
+			pFree = pSlot;
+		}
+
+	private:
+		static constexpr size_t ChunkSize = 1024; // links per chunk
+
+		union Slot
+		{
+			Slot *NextFree;
+			alignas(C4ObjectLink) unsigned char Link[sizeof(C4ObjectLink)];
+		};
+
+		Slot *pFree = nullptr;
+
+		void AddChunk()
+		{
+			Slot *pChunk = new Slot[ChunkSize];
+			// free list in address order
+			for (size_t i = 0; i < ChunkSize - 1; ++i)
+				pChunk[i].NextFree = pChunk + i + 1;
+			pChunk[ChunkSize - 1].NextFree = pFree;
+			pFree = pChunk;
+		}
+	};
+
+	C4ObjectLinkPool ObjectLinkPool;
+}
+
+void *C4ObjectLink::operator new(size_t iSize)
+{
+	assert(iSize == sizeof(C4ObjectLink));
+	return ObjectLinkPool.Allocate();
+}
+
+void C4ObjectLink::operator delete(void *pLink)
+{
+	if (pLink) ObjectLinkPool.Free(pLink);
+}
+
+void C4ObjectNumberIndex::Add(C4Object *pObj, C4ObjectLink *pLnk)
+{
+	Entries[pObj] = {pObj->Number, pLnk};
+	// on (invalid) duplicate numbers, the object indexed first is found
+	Objects.try_emplace(pObj->Number, pObj);
+}
+
+void C4ObjectNumberIndex::Remove(C4Object *pObj)
+{
+	const auto it = Entries.find(pObj);
+	if (it == Entries.end()) return;
+	const auto itObj = Objects.find(it->second.Number);
+	if (itObj != Objects.end() && itObj->second == pObj) Objects.erase(itObj);
+	Entries.erase(it);
+}
+
+void C4ObjectNumberIndex::Clear()
+{
+	Objects.clear();
+	Entries.clear();
+}
+
+void C4ObjectNumberIndex::SetLink(C4Object *pObj, C4ObjectLink *pLnk)
+{
+	const auto it = Entries.find(pObj);
+	if (it != Entries.end()) it->second.Link = pLnk;
+}
+
+C4Object *C4ObjectNumberIndex::Find(int32_t iNumber) const
+{
+	const auto it = Objects.find(iNumber);
+	return it != Objects.end() ? it->second : nullptr;
+}
+
+C4ObjectLink *C4ObjectNumberIndex::GetLink(C4Object *pObj) const
+{
+	const auto it = Entries.find(pObj);
+	return it != Entries.end() ? it->second.Link : nullptr;
+}
+
+void C4ObjectTypeIndex::Add(C4Object *pObj, C4ObjectList *pMainList)
+{
+	if (!Keys.emplace(pObj, Key{pObj->id, pObj->Category}).second) return;
+	C4ObjectIndexList &IDList = IDLists[pObj->id];
+	if (IDList.Objects.Add(pObj, C4ObjectList::stMain, pMainList)) ++IDList.Count;
+	for (int32_t i = 0; i < 32; ++i)
+		if (static_cast<uint32_t>(pObj->Category) & (1u << i))
+			if (CategoryLists[i].Objects.Add(pObj, C4ObjectList::stMain, pMainList))
+				++CategoryLists[i].Count;
+}
+
+void C4ObjectTypeIndex::Remove(C4Object *pObj)
+{
+	const auto it = Keys.find(pObj);
+	if (it == Keys.end()) return;
+	const auto itIDList = IDLists.find(it->second.id);
+	if (itIDList != IDLists.end() && itIDList->second.Objects.Remove(pObj))
+		if (!--itIDList->second.Count)
+			IDLists.erase(itIDList);
+	for (int32_t i = 0; i < 32; ++i)
+		if (static_cast<uint32_t>(it->second.Category) & (1u << i))
+			if (CategoryLists[i].Objects.Remove(pObj))
+				--CategoryLists[i].Count;
+	Keys.erase(it);
+}
+
+void C4ObjectTypeIndex::Update(C4Object *pObj, C4ObjectList *pMainList)
+{
+	// only objects of the main list are indexed
+	const auto it = Keys.find(pObj);
+	if (it == Keys.end()) return;
+	if (it->second.id == pObj->id && it->second.Category == pObj->Category) return;
+	Remove(pObj);
+	Add(pObj, pMainList);
+}
+
+void C4ObjectTypeIndex::Clear()
+{
+	Keys.clear();
+	IDLists.clear();
+	for (C4ObjectIndexList &List : CategoryLists)
+	{
+		List.Objects.Clear();
+		List.Count = 0;
+	}
+}
+
+C4ObjectIndexList *C4ObjectTypeIndex::GetIDList(C4ID id)
+{
+	const auto it = IDLists.find(id);
+	return it != IDLists.end() ? &it->second : nullptr;
+}
+
+C4ObjectIndexList *C4ObjectTypeIndex::GetCategoryList(int32_t iCategory)
+{
+	const uint32_t dwCategory = static_cast<uint32_t>(iCategory);
+	if (!dwCategory || (dwCategory & (dwCategory - 1))) return nullptr;
+	int32_t i = 0;
+	while (!(dwCategory & (1u << i))) ++i;
+	return &CategoryLists[i];
+}
+
 C4ObjectList::C4ObjectList() : FirstIter(nullptr)
 {
 	Default();
@@ -48,6 +209,7 @@ void C4ObjectList::Clear()
 	}
 	First = Last = nullptr;
 	delete pEnumerated; pEnumerated = nullptr;
+	if (pNumberIndex) pNumberIndex->Clear();
 }
 
 const int MaxTempListID = 500;
@@ -219,6 +381,8 @@ bool C4ObjectList::Add(C4Object *nObj, SortType eSort, C4ObjectList *pLstSorted)
 	// Insert new link after predecessor
 	InsertLink(nLnk, cPrev);
 
+	if (pNumberIndex) pNumberIndex->Add(nObj, nLnk);
+
 #ifdef _DEBUG
 	// Debug: Check sort
 	if (eSort == stMain)
@@ -240,9 +404,7 @@ bool C4ObjectList::Remove(C4Object *pObj)
 	C4ObjectLink *cLnk;
 
 	// Find link
-	for (cLnk = First; cLnk; cLnk = cLnk->Next)
-		if (cLnk->Obj == pObj) break;
-	if (!cLnk) return false;
+	if (!(cLnk = GetLink(pObj))) return false;
 
 	// Fix iterators
 	for (iterator *i = FirstIter; i; i = i->Next)
@@ -253,6 +415,8 @@ bool C4ObjectList::Remove(C4Object *pObj)
 	// Remove link from list
 	RemoveLink(cLnk);
 
+	if (pNumberIndex) pNumberIndex->Remove(pObj);
+
 	// Deallocate link
 	delete cLnk;
 
@@ -308,6 +472,7 @@ C4Object *C4ObjectList::GetObject(int Index)
 C4ObjectLink *C4ObjectList::GetLink(C4Object *pObj)
 {
 	if (!pObj) return nullptr;
+	if (pNumberIndex) return pNumberIndex->GetLink(pObj);
 	C4ObjectLink *cLnk;
 	for (cLnk = First; cLnk; cLnk = cLnk->Next)
 		if (cLnk->Obj == pObj)
@@ -430,6 +595,7 @@ long C4ObjectList::ObjectNumber(C4Object *pObj)
 {
 	C4ObjectLink *cLnk;
 	if (!pObj) return 0;
+	if (pNumberIndex) return pNumberIndex->Contains(pObj) ? pObj->Number : 0;
 	for (cLnk = First; cLnk; cLnk = cLnk->Next)
 		if (cLnk->Obj == pObj)
 			return cLnk->Obj->Number;
@@ -439,6 +605,7 @@ long C4ObjectList::ObjectNumber(C4Object *pObj)
 bool C4ObjectList::IsContained(C4Object *pObj)
 {
 	C4ObjectLink *cLnk;
+	if (pNumberIndex) return pNumberIndex->Contains(pObj);
 	for (cLnk = First; cLnk; cLnk = cLnk->Next)
 		if (cLnk->Obj == pObj)
 			return true;
@@ -541,6 +708,7 @@ void C4ObjectList::CompileFunc(StdCompiler *pComp, bool fSaveRefs, bool fSkipPla
 C4Object *C4ObjectList::ObjectPointer(int32_t iNumber)
 {
 	C4ObjectLink *cLnk;
+	if (pNumberIndex) return pNumberIndex->Find(iNumber);
 	for (cLnk = First; cLnk; cLnk = cLnk->Next)
 		if (cLnk->Obj->Number == iNumber)
 			return cLnk->Obj;
@@ -767,13 +935,33 @@ void C4ObjectList::Default()
 	First = Last = nullptr;
 	Mass = 0;
 	pEnumerated = nullptr;
+	if (pNumberIndex) pNumberIndex->Clear();
+}
+
+void C4ObjectList::EnableNumberIndex()
+{
+	if (!pNumberIndex) pNumberIndex.reset(new C4ObjectNumberIndex);
+	UpdateNumberIndex();
+}
+
+void C4ObjectList::UpdateNumberIndex()
+{
+	if (!pNumberIndex) return;
+	pNumberIndex->Clear();
+	for (C4ObjectLink *cLnk = First; cLnk; cLnk = cLnk->Next)
+		pNumberIndex->Add(cLnk->Obj, cLnk);
+}
+
+void C4ObjectList::UpdateLink(C4ObjectLink *pLnk)
+{
+	if (pNumberIndex) pNumberIndex->SetLink(pLnk->Obj, pLnk);
 }
 
 void C4ObjectList::UpdateTransferZones()
 {
 	C4Object *cobj; C4ObjectLink *clnk;
 	for (clnk = First; clnk && (cobj = clnk->Obj); clnk = clnk->Next)
-		cobj->Call(PSF_UpdateTransferZone);
+		cobj->Call(OCB_UpdateTransferZone);
 }
 
 void C4ObjectList::ResetAudibility()
@@ -21,6 +21,9 @@
 #include <C4Id.h>
 #include <C4Def.h>
 
+#include <memory>
+#include <unordered_map>
+
 class C4Object;
 class C4FacetEx;
 
@@ -29,6 +32,10 @@ class C4ObjectLink
 public:
 	C4Object *Obj;
 	C4ObjectLink *Prev, *Next;
+
+	// links are taken from a pool of contiguous chunks; main thread only
+	static void *operator new(size_t iSize);
+	static void operator delete(void *pLink);
 };
 
 class C4ObjectListChangeListener
@@ -42,6 +49,30 @@ public:
 
 extern C4ObjectListChangeListener &ObjectListChangeListener;
 
+// index of the objects of a list by their number
+class C4ObjectNumberIndex
+{
+public:
+	void Add(C4Object *pObj, C4ObjectLink *pLnk);
+	void Remove(C4Object *pObj);
+	void Clear();
+	void SetLink(C4Object *pObj, C4ObjectLink *pLnk); // object was moved to another link of the list
+
+	C4Object *Find(int32_t iNumber) const;
+	C4ObjectLink *GetLink(C4Object *pObj) const;
+	bool Contains(C4Object *pObj) const { return Entries.count(pObj) > 0; }
+
+private:
+	struct Entry
+	{
+		int32_t Number; // number the object was indexed with
+		C4ObjectLink *Link;
+	};
+
+	std::unordered_map<int32_t, C4Object *> Objects; // objects by number
+	std::unordered_map<C4Object *, Entry> Entries;
+};
+
 class C4ObjectList
 {
 public:
@@ -52,6 +83,7 @@ public:
 	C4ObjectLink *First, *Last;
 	int Mass;
 	std::list<int32_t> *pEnumerated;
+	std::unique_ptr<C4ObjectNumberIndex> pNumberIndex; // only kept for lists that are frequently searched by number
 
 	enum SortType { stNone = 0, stMain, stContents, stReverse, };
 
@@ -141,6 +173,10 @@ public:
 
 	void UpdateScriptPointers(); // update pointers to C4AulScript *
 
+	void EnableNumberIndex(); // keep an index of all objects by number from now on
+	void UpdateNumberIndex(); // rebuild number index after list or object numbers were manipulated directly
+	void UpdateLink(C4ObjectLink *pLnk); // update indices after the object of a link was set directly
+
 	bool CheckSort(C4ObjectList *pList); // check that all objects of this list appear in the other list in the same order
 	void CheckCategorySort(); // assertwhether sorting by category is done right
 
@@ -156,6 +192,40 @@ protected:
 	friend class C4ObjResort;
 };
 
+// objects of the main object list sharing an id or a category bit, sorted like the main list
+struct C4ObjectIndexList
+{
+	C4ObjectIndexList() : Count(0) {}
+
+	C4ObjectList Objects;
+	int32_t Count; // number of objects in the list
+};
+
+// secondary indices of the main object list for FindObject searches
+class C4ObjectTypeIndex
+{
+public:
+	void Add(C4Object *pObj, C4ObjectList *pMainList); // object must already be in the main list
+	void Remove(C4Object *pObj);
+	void Update(C4Object *pObj, C4ObjectList *pMainList); // reindex after id or category change
+	void Clear();
+
+	C4ObjectIndexList *GetIDList(C4ID id); // nullptr if there is no such object
+	C4ObjectIndexList *GetCategoryList(int32_t iCategory); // single category bits only; nullptr otherwise
+	int32_t GetObjectCount() const { return static_cast<int32_t>(Keys.size()); }
+
+private:
+	struct Key
+	{
+		C4ID id;
+		int32_t Category;
+	};
+
+	std::unordered_map<C4Object *, Key> Keys; // id and category the objects were indexed with
+	std::unordered_map<C4ID, C4ObjectIndexList> IDLists;
+	C4ObjectIndexList CategoryLists[32]; // by category bit
+};
+
 class C4NotifyingObjectList : public C4ObjectList
 {
 public:
@@ -22,10 +22,56 @@
 #include <C4Physics.h>
 #include <C4Random.h>
 #include <C4Wrappers.h>
+#include <C4Application.h>
 
 static const FIXED WindDrift_Factor = itofix(1, 800);
 
-void C4PXS::Execute()
+void C4PXS::ApplyForces(int32_t iX, int32_t iY, uint32_t iSeed, FIXED &rxdir, FIXED &rydir)
+{
+	// Gravity
+	rydir += GravAccel;
+
+	if (GBackDensity(iX, iY + 1) < Game.Material.Map[Mat].Density)
+	{
+		// Air speed: Wind plus some random
+		// The random values are seeded per PXS instead of taken from the game's random sequence,
+		// so PXS can be moved in any order. This moves PXS differently than engines that used
+		// the random sequence, so records of those do not replay identically.
+		const uint32_t iSeed2 = iSeed * 214013L + 2531011L;
+		int32_t iWind = GBackWind(iX, iY);
+		FIXED txdir = itofix(iWind, 15) + FIXED256(static_cast<int32_t>(SeededRandom(iSeed, 1200)) - 600);
+		FIXED tydir = FIXED256(static_cast<int32_t>(SeededRandom(iSeed2, 1200)) - 600);
+
+		// Air friction, based on WindDrift. MaxSpeed is ignored.
+		int32_t iWindDrift = (std::max)(Game.Material.Map[Mat].WindDrift - 20, 0);
+		rxdir += ((txdir - rxdir) * iWindDrift) * WindDrift_Factor;
+		rydir += ((tydir - rydir) * iWindDrift) * WindDrift_Factor;
+	}
+}
+
+bool C4PXS::ExecuteFreeMovement(uint32_t iSeed)
+{
+	// Everything but unhindered movement within the landscape is left to Execute
+	if (!MatValid(Mat)) return false;
+	if ((x < 0) || (x >= GBackWdt) || (y < -10) || (y >= GBackHgt)) return false;
+	int32_t iX = fixtoi(x), iY = fixtoi(y);
+	if (Game.Material.GetReactionUnsafe(Mat, GBackMat(iX, iY))) return false;
+
+	FIXED nxdir = xdir, nydir = ydir;
+	ApplyForces(iX, iY, iSeed, nxdir, nydir);
+
+	FIXED ctcox = x + nxdir;
+	FIXED ctcoy = y + nydir;
+	int32_t iToX = fixtoi(ctcox), iToY = fixtoi(ctcoy);
+	if (!Inside<int32_t>(iToX, 0, GBackWdt - 1) || !Inside<int32_t>(iToY, 0, GBackHgt - 1)) return false;
+	if (!Game.Landscape._PathFree(iX, iY, iToX, iToY)) return false;
+
+	x = ctcox; y = ctcoy;
+	xdir = nxdir; ydir = nydir;
+	return true;
+}
+
+void C4PXS::Execute(uint32_t iSeed)
 {
 #ifdef DEBUGREC_PXS
 	{
@@ -58,21 +104,8 @@ void C4PXS::Execute()
 		Deactivate(); return;
 	}
 
-	// Gravity
-	ydir += GravAccel;
-
-	if (GBackDensity(iX, iY + 1) < Game.Material.Map[Mat].Density)
-	{
-		// Air speed: Wind plus some random
-		int32_t iWind = GBackWind(iX, iY);
-		FIXED txdir = itofix(iWind, 15) + FIXED256(Random(1200) - 600);
-		FIXED tydir = FIXED256(Random(1200) - 600);
-
-		// Air friction, based on WindDrift. MaxSpeed is ignored.
-		int32_t iWindDrift = (std::max)(Game.Material.Map[Mat].WindDrift - 20, 0);
-		xdir += ((txdir - xdir) * iWindDrift) * WindDrift_Factor;
-		ydir += ((tydir - ydir) * iWindDrift) * WindDrift_Factor;
-	}
+	// Gravity and air friction
+	ApplyForces(iX, iY, iSeed, xdir, ydir);
 
 	FIXED ctcox = x + xdir;
 	FIXED ctcoy = y + ydir;
@@ -138,8 +171,8 @@ void C4PXS::Deactivate()
 	rc.pos = 2;
 	AddDbgRec(RCT_ExecPXS, &rc, sizeof(rc));
 #endif
+	// removed from the PXS system by the caller
 	Mat = MNone;
-	Game.PXS.Delete(this);
 }
 
 C4PXSSystem::C4PXSSystem()
@@ -155,82 +188,149 @@ C4PXSSystem::~C4PXSSystem()
 void C4PXSSystem::Default()
 {
 	Count = 0;
-	for (unsigned int cnt = 0; cnt < PXSMaxChunk; cnt++)
-	{
-		Chunk[cnt] = nullptr;
-		iChunkPXS[cnt] = 0;
-	}
+	iNextGfxIndex = 0;
 }
 
 void C4PXSSystem::Clear()
 {
-	for (unsigned int cnt = 0; cnt < PXSMaxChunk; cnt++)
-	{
-		delete[] Chunk[cnt];
-		Chunk[cnt] = nullptr;
-		iChunkPXS[cnt] = 0;
-	}
+	Mat.clear(); Mat.shrink_to_fit();
+	X.clear(); X.shrink_to_fit();
+	Y.clear(); Y.shrink_to_fit();
+	XDir.clear(); XDir.shrink_to_fit();
+	YDir.clear(); YDir.shrink_to_fit();
+	GfxIndex.clear(); GfxIndex.shrink_to_fit();
+	Pending.clear(); Pending.shrink_to_fit();
+	StripeOrder.clear(); StripeOrder.shrink_to_fit();
+	StripeStart.clear(); StripeStart.shrink_to_fit();
 }
 
-C4PXS *C4PXSSystem::New()
+C4PXS C4PXSSystem::Get(size_t iIndex) const
 {
-	unsigned int cnt, cnt2;
-	C4PXS *pxp;
-	// Check chunks for available space
-	for (cnt = 0; cnt < PXSMaxChunk; cnt++)
+	C4PXS PXS;
+	PXS.Mat = Mat[iIndex];
+	PXS.x = X[iIndex]; PXS.y = Y[iIndex];
+	PXS.xdir = XDir[iIndex]; PXS.ydir = YDir[iIndex];
+	return PXS;
+}
+
+void C4PXSSystem::Set(size_t iIndex, const C4PXS &rPXS)
+{
+	Mat[iIndex] = rPXS.Mat;
+	X[iIndex] = rPXS.x; Y[iIndex] = rPXS.y;
+	XDir[iIndex] = rPXS.xdir; YDir[iIndex] = rPXS.ydir;
+}
+
+void C4PXSSystem::Add(const C4PXS &rPXS)
+{
+	Mat.push_back(rPXS.Mat);
+	X.push_back(rPXS.x); Y.push_back(rPXS.y);
+	XDir.push_back(rPXS.xdir); YDir.push_back(rPXS.ydir);
+	GfxIndex.push_back(iNextGfxIndex);
+	Pending.push_back(0);
+	if (++iNextGfxIndex >= PXSChunkSize) iNextGfxIndex = 0;
+}
+
+void C4PXSSystem::Remove(size_t iIndex)
+{
+	// move the last PXS into the gap
+	const size_t iLast = Mat.size() - 1;
+	if (iIndex != iLast)
 	{
-		// Create new chunk if necessary
-		if (!Chunk[cnt])
-		{
-			if (!(Chunk[cnt] = new C4PXS[PXSChunkSize])) return nullptr;
-			iChunkPXS[cnt] = 0;
-		}
-		// Check this chunk for space
-		if (iChunkPXS[cnt] < PXSChunkSize)
-			for (cnt2 = 0, pxp = Chunk[cnt]; cnt2 < PXSChunkSize; cnt2++, pxp++)
-				if (pxp->Mat == MNone)
-				{
-					// count theam
-					iChunkPXS[cnt]++;
-					return pxp;
-				}
+		Mat[iIndex] = Mat[iLast];
+		X[iIndex] = X[iLast]; Y[iIndex] = Y[iLast];
+		XDir[iIndex] = XDir[iLast]; YDir[iIndex] = YDir[iLast];
+		GfxIndex[iIndex] = GfxIndex[iLast];
+		Pending[iIndex] = Pending[iLast];
 	}
-	return nullptr;
+	Mat.pop_back();
+	X.pop_back(); Y.pop_back();
+	XDir.pop_back(); YDir.pop_back();
+	GfxIndex.pop_back();
+	Pending.pop_back();
 }
 
 bool C4PXSSystem::Create(int32_t mat, FIXED ix, FIXED iy, FIXED ixdir, FIXED iydir)
 {
-	C4PXS *pxp;
 	if (!MatValid(mat)) return false;
-	if (!(pxp = New())) return false;
-	pxp->Mat = mat;
-	pxp->x = ix; pxp->y = iy;
-	pxp->xdir = ixdir; pxp->ydir = iydir;
+	if (Mat.size() >= static_cast<size_t>((std::max)(Game.C4S.Landscape.MaxPXS, 0))) return false;
+	C4PXS PXS;
+	PXS.Mat = mat;
+	PXS.x = ix; PXS.y = iy;
+	PXS.xdir = ixdir; PXS.ydir = iydir;
+	Add(PXS);
 	return true;
 }
 
+uint32_t C4PXSSystem::GetSeed(uint32_t iSeedBase, size_t iIndex)
+{
+	// spread consecutive PXS over the seed space
+	return iSeedBase + static_cast<uint32_t>(iIndex) * 2654435761u;
+}
+
+void C4PXSSystem::SortByStripes()
+{
+	// counting sort by stripe; PXS outside the landscape go into the first or last stripe
+	const int32_t iStripes = (std::max)((GBackHgt + PXSStripeHeight - 1) / PXSStripeHeight, 1);
+	const size_t iCount = Mat.size();
+	StripeStart.assign(iStripes + 1, 0);
+	for (size_t i = 0; i < iCount; ++i)
+		++StripeStart[BoundBy<int32_t>(fixtoi(Y[i]) / PXSStripeHeight, 0, iStripes - 1) + 1];
+	for (int32_t iStripe = 0; iStripe < iStripes; ++iStripe)
+		StripeStart[iStripe + 1] += StripeStart[iStripe];
+	StripeOrder.resize(iCount);
+	for (size_t i = 0; i < iCount; ++i)
+		StripeOrder[StripeStart[BoundBy<int32_t>(fixtoi(Y[i]) / PXSStripeHeight, 0, iStripes - 1)]++] = static_cast<uint32_t>(i);
+}
+
 void C4PXSSystem::Execute()
 {
-	// Execute all chunks
-	Count = 0;
-	for (unsigned int cchunk = 0; cchunk < PXSMaxChunk; cchunk++)
-		if (Chunk[cchunk])
-			// empty chunk?
-			if (!iChunkPXS[cchunk])
-			{
-				delete[] Chunk[cchunk]; Chunk[cchunk] = nullptr;
-			}
-			else
-			{
-				// Execute chunk pxs, check for empty
-				C4PXS *pxp = Chunk[cchunk];
-				for (unsigned int cnt2 = 0; cnt2 < PXSChunkSize; cnt2++, pxp++)
-					if (pxp->Mat != MNone)
-					{
-						pxp->Execute();
-						Count++;
-					}
-			}
+	Count = static_cast<int32_t>(Mat.size());
+	if (!Count) return;
+
+	// Seed of this frame; taken from the game's random state without advancing it
+	const uint32_t iSeedBase = RandomHold ^ (static_cast<uint32_t>(Game.FrameCounter) * 0x9e3779b9u);
+
+	// First pass: move all PXS that do not touch anything, concurrently.
+	// Every task gets a block of PXS from neighbouring landscape stripes, so it reads a compact part of the landscape.
+	// This only reads the landscape, so the result does not depend on the thread count or the partitioning.
+	const size_t iCount = Mat.size();
+	SortByStripes();
+	Application.ThreadPool.ParallelFor((iCount + PXSChunkSize - 1) / PXSChunkSize, [this, iSeedBase, iCount](size_t iBlock)
+	{
+		const size_t iEnd = (std::min)((iBlock + 1) * PXSChunkSize, iCount);
+		for (size_t iOrder = iBlock * PXSChunkSize; iOrder < iEnd; ++iOrder)
+		{
+			const size_t i = StripeOrder[iOrder];
+			C4PXS PXS = Get(i);
+			Pending[i] = !PXS.ExecuteFreeMovement(GetSeed(iSeedBase, i));
+			if (!Pending[i]) Set(i, PXS);
+		}
+	});
+#ifdef DEBUGREC_PXS
+	for (size_t i = 0; i < iCount; ++i)
+		if (!Pending[i])
+		{
+			C4RCExecPXS rc;
+			rc.x = X[i]; rc.y = Y[i]; rc.iMat = Mat[i];
+			rc.pos = 1;
+			AddDbgRec(RCT_ExecPXS, &rc, sizeof(rc));
+		}
+#endif
+
+	// Second pass: all other PXS may react with the landscape, so execute them in order.
+	// PXS created meanwhile are appended and not pending; removing one moves the last PXS into its place.
+	for (size_t i = 0; i < Mat.size(); )
+	{
+		if (!Pending[i]) { ++i; continue; }
+		Pending[i] = 0;
+		// work on a copy, because reactions may create PXS and thus reallocate the arrays
+		C4PXS PXS = Get(i);
+		PXS.Execute(GetSeed(iSeedBase, i));
+		if (PXS.Mat == MNone)
+			Remove(i);
+		else
+			Set(i++, PXS);
+	}
 }
 
 void C4PXSSystem::Draw(C4FacetEx &cgo)
@@ -241,33 +341,28 @@ void C4PXSSystem::Draw(C4FacetEx &cgo)
 
 	// First pass: draw old-style PXS (lines/pixels)
 	int32_t cgox = cgo.X - cgo.TargetX, cgoy = cgo.Y - cgo.TargetY;
-	unsigned int cnt;
-	for (cnt = 0; cnt < PXSMaxChunk; cnt++)
-		if (Chunk[cnt] && iChunkPXS[cnt])
+	const size_t iCount = Mat.size();
+	for (size_t i = 0; i < iCount; i++)
+		if (VisibleRect.Contains(fixtoi(X[i]), fixtoi(Y[i])))
 		{
-			C4PXS *pxp = Chunk[cnt];
-			for (unsigned int cnt2 = 0; cnt2 < PXSChunkSize; cnt2++, pxp++)
-				if (pxp->Mat != MNone && VisibleRect.Contains(fixtoi(pxp->x), fixtoi(pxp->y)))
-				{
-					C4Material *pMat = &Game.Material.Map[pxp->Mat];
-					if (pMat->PXSFace.Surface && Config.Graphics.PXSGfx)
-						continue;
-					// old-style: unicolored pixels or lines
-					uint32_t dwMatClr = Game.Landscape.GetPal()->GetClr((uint8_t)(Mat2PixColDefault(pxp->Mat)));
-					if (fixtoi(pxp->xdir) || fixtoi(pxp->ydir))
-					{
-						// lines for stuff that goes whooosh!
-						int len = fixtoi(Abs(pxp->xdir) + Abs(pxp->ydir));
-						dwMatClr = uint32_t(std::max<int>(dwMatClr >> 24, 195 - (195 - (dwMatClr >> 24)) / len)) << 24 | (dwMatClr & 0xffffff);
-						Application.DDraw->DrawLineDw(cgo.Surface,
-							fixtof(pxp->x - pxp->xdir) + cgox, fixtof(pxp->y - pxp->ydir) + cgoy,
-							fixtof(pxp->x) + cgox, fixtof(pxp->y) + cgoy,
-							dwMatClr);
-					}
-					else
-						// single pixels for slow stuff
-						Application.DDraw->DrawPix(cgo.Surface, fixtof(pxp->x) + cgox, fixtof(pxp->y) + cgoy, dwMatClr);
-				}
+			C4Material *pMat = &Game.Material.Map[Mat[i]];
+			if (pMat->PXSFace.Surface && Config.Graphics.PXSGfx)
+				continue;
+			// old-style: unicolored pixels or lines
+			uint32_t dwMatClr = Game.Landscape.GetPal()->GetClr((uint8_t)(Mat2PixColDefault(Mat[i])));
+			if (fixtoi(XDir[i]) || fixtoi(YDir[i]))
+			{
+				// lines for stuff that goes whooosh!
+				int len = fixtoi(Abs(XDir[i]) + Abs(YDir[i]));
+				dwMatClr = uint32_t(std::max<int>(dwMatClr >> 24, 195 - (195 - (dwMatClr >> 24)) / len)) << 24 | (dwMatClr & 0xffffff);
+				Application.DDraw->DrawLineDw(cgo.Surface,
+					fixtof(X[i] - XDir[i]) + cgox, fixtof(Y[i] - YDir[i]) + cgoy,
+					fixtof(X[i]) + cgox, fixtof(Y[i]) + cgoy,
+					dwMatClr);
+			}
+			else
+				// single pixels for slow stuff
+				Application.DDraw->DrawPix(cgo.Surface, fixtof(X[i]) + cgox, fixtof(Y[i]) + cgoy, dwMatClr);
 		}
 
 	// PXS graphics disabled?
@@ -275,28 +370,24 @@ void C4PXSSystem::Draw(C4FacetEx &cgo)
 		return;
 
 	// Second pass: draw new-style PXS (graphics)
-	for (cnt = 0; cnt < PXSMaxChunk; cnt++)
-		if (Chunk[cnt] && iChunkPXS[cnt])
+	for (size_t i = 0; i < iCount; i++)
+		if (VisibleRect.Contains(fixtoi(X[i]), fixtoi(Y[i])))
 		{
-			C4PXS *pxp = Chunk[cnt];
-			for (unsigned int cnt2 = 0; cnt2 < PXSChunkSize; cnt2++, pxp++)
-				if (pxp->Mat != MNone && VisibleRect.Contains(fixtoi(pxp->x), fixtoi(pxp->y)))
-				{
-					C4Material *pMat = &Game.Material.Map[pxp->Mat];
-					if (!pMat->PXSFace.Surface)
-						continue;
-					// new-style: graphics
-					int32_t pnx, pny;
-					pMat->PXSFace.GetPhaseNum(pnx, pny);
-					int32_t fcWdt = pMat->PXSFace.Wdt; int32_t fcWdtH = (std::max)(fcWdt / 3, 1);
-					// calculate draw width and tile to use (random-ish)
-					int32_t z = 1 + ((cnt2 / std::max<int32_t>(pnx * pny, 1)) ^ 341) % pMat->PXSGfxSize;
-					pny = (cnt2 / pnx) % pny; pnx = cnt2 % pnx;
-					// draw
-					Application.DDraw->ActivateBlitModulation((std::min)((fcWdtH - z) * 16, 255) << 24 | 0xffffff);
-					pMat->PXSFace.DrawX(cgo.Surface, fixtoi(pxp->x) + cgox + z * pMat->PXSGfxRt.tx / fcWdt, fixtoi(pxp->y) + cgoy + z * pMat->PXSGfxRt.ty / fcWdt, z, z * pMat->PXSFace.Hgt / fcWdt, pnx, pny);
-					Application.DDraw->DeactivateBlitModulation();
-				}
+			C4Material *pMat = &Game.Material.Map[Mat[i]];
+			if (!pMat->PXSFace.Surface)
+				continue;
+			// new-style: graphics
+			const int32_t iGfxIndex = GfxIndex[i];
+			int32_t pnx, pny;
+			pMat->PXSFace.GetPhaseNum(pnx, pny);
+			int32_t fcWdt = pMat->PXSFace.Wdt; int32_t fcWdtH = (std::max)(fcWdt / 3, 1);
+			// calculate draw width and tile to use (random-ish)
+			int32_t z = 1 + ((iGfxIndex / std::max<int32_t>(pnx * pny, 1)) ^ 341) % pMat->PXSGfxSize;
+			pny = (iGfxIndex / pnx) % pny; pnx = iGfxIndex % pnx;
+			// draw
+			Application.DDraw->ActivateBlitModulation((std::min)((fcWdtH - z) * 16, 255) << 24 | 0xffffff);
+			pMat->PXSFace.DrawX(cgo.Surface, fixtoi(X[i]) + cgox + z * pMat->PXSGfxRt.tx / fcWdt, fixtoi(Y[i]) + cgoy + z * pMat->PXSGfxRt.ty / fcWdt, z, z * pMat->PXSFace.Hgt / fcWdt, pnx, pny);
+			Application.DDraw->DeactivateBlitModulation();
 		}
 }
 
@@ -317,14 +408,8 @@ void C4PXSSystem::Cast(int32_t mat, int32_t num, int32_t tx, int32_t ty, int32_t
 
 bool C4PXSSystem::Save(C4Group &hGroup)
 {
-	unsigned int cnt;
-
-	// Check used chunk count
-	int32_t iChunks = 0;
-	for (cnt = 0; cnt < PXSMaxChunk; cnt++)
-		if (Chunk[cnt] && iChunkPXS[cnt])
-			iChunks++;
-	if (!iChunks)
+	// Nothing to save?
+	if (Mat.empty())
 	{
 		hGroup.Delete(C4CFN_PXS);
 		return true;
@@ -341,10 +426,15 @@ bool C4PXSSystem::Save(C4Group &hGroup)
 #endif
 	if (!hTempFile.Write(&iNumFormat, sizeof(iNumFormat)))
 		return false;
-	for (cnt = 0; cnt < PXSMaxChunk; cnt++)
-		if (Chunk[cnt]) // must save all chunks in order to keep order consistent on all clients
-			if (!hTempFile.Write(Chunk[cnt], PXSChunkSize * sizeof(C4PXS)))
-				return false;
+	// the file format stores whole chunks of PXS records; the last chunk is padded with inactive ones
+	std::vector<C4PXS> Chunk(PXSChunkSize);
+	for (size_t iStart = 0; iStart < Mat.size(); iStart += PXSChunkSize)
+	{
+		for (size_t cnt = 0; cnt < PXSChunkSize; cnt++)
+			Chunk[cnt] = iStart + cnt < Mat.size() ? Get(iStart + cnt) : C4PXS();
+		if (!hTempFile.Write(Chunk.data(), PXSChunkSize * sizeof(C4PXS)))
+			return false;
+	}
 
 	if (!hTempFile.Close())
 		return false;
@@ -377,29 +467,42 @@ bool C4PXSSystem::Load(C4Group &hGroup)
 	else if (iBinSize % iChunkSize != 0) return false;
 	// calc chunk count
 	iChunkNum = iBinSize / iChunkSize;
-	if (iChunkNum > PXSMaxChunk) return false;
-	for (uint32_t cnt = 0; cnt < iChunkNum; cnt++)
+	std::vector<C4PXS> Chunk(PXSChunkSize);
+	for (size_t cnt = 0; cnt < iChunkNum; cnt++)
 	{
-		if (!(Chunk[cnt] = new C4PXS[PXSChunkSize])) return false;
-		if (!hGroup.Read(Chunk[cnt], iChunkSize)) return false;
-		// count the PXS, Peter!
-		// convert num format, if neccessary
-		C4PXS *pxp; iChunkPXS[cnt] = 0;
-		for (cnt2 = 0, pxp = Chunk[cnt]; cnt2 < PXSChunkSize; cnt2++, pxp++)
-			if (pxp->Mat != MNone)
-			{
-				++iChunkPXS[cnt];
-				// convert number format
+		if (!hGroup.Read(Chunk.data(), iChunkSize)) return false;
+		// add the PXS, Peter!
+		for (cnt2 = 0; cnt2 < PXSChunkSize; cnt2++)
+		{
+			C4PXS *pxp = &Chunk[cnt2];
+			if (pxp->Mat == MNone) continue;
+			// convert number format, if neccessary
 #ifdef USE_FIXED
-				if (iNumForm == 2) { FLOAT_TO_FIXED(&pxp->x); FLOAT_TO_FIXED(&pxp->y); FLOAT_TO_FIXED(&pxp->xdir); FLOAT_TO_FIXED(&pxp->ydir); }
+			if (iNumForm == 2) { FLOAT_TO_FIXED(&pxp->x); FLOAT_TO_FIXED(&pxp->y); FLOAT_TO_FIXED(&pxp->xdir); FLOAT_TO_FIXED(&pxp->ydir); }
 #else
-				if (iNumForm == 1) { FIXED_TO_FLOAT(&pxp->x); FIXED_TO_FLOAT(&pxp->y); FIXED_TO_FLOAT(&pxp->xdir); FIXED_TO_FLOAT(&pxp->ydir); }
+			if (iNumForm == 1) { FIXED_TO_FLOAT(&pxp->x); FIXED_TO_FLOAT(&pxp->y); FIXED_TO_FLOAT(&pxp->xdir); FIXED_TO_FLOAT(&pxp->ydir); }
 #endif
-			}
+			Add(*pxp);
+			// keep the graphics of files written with fixed chunk slots
+			GfxIndex.back() = static_cast<uint16_t>(cnt2);
+		}
 	}
 	return true;
 }
 
+uint32_t C4PXSSystem::GetChecksum() const
+{
+	uint32_t iCRC = 0;
+	const auto Hash = [&iCRC](const auto &Values)
+	{
+		iCRC = crc32(iCRC, reinterpret_cast<const Bytef *>(Values.data()), static_cast<uInt>(Values.size() * sizeof(Values[0])));
+	};
+	Hash(Mat);
+	Hash(X); Hash(Y);
+	Hash(XDir); Hash(YDir);
+	return iCRC;
+}
+
 void C4PXSSystem::Synchronize()
 {
 	Count = 0;
@@ -407,33 +510,14 @@ void C4PXSSystem::Synchronize()
 
 void C4PXSSystem::SyncClearance()
 {
-	// consolidate chunks; remove empty chunks
-	C4PXS **pDestChunk = Chunk;
-	int32_t iDestChunk = 0;
-	for (unsigned int cnt = 0; cnt < PXSMaxChunk; cnt++)
+	// release memory of PXS that are gone
+	if (Mat.capacity() > 2 * Mat.size() + PXSChunkSize)
 	{
-		if (Chunk[cnt] && iChunkPXS[cnt])
-		{
-			*pDestChunk++ = Chunk[cnt];
-			iChunkPXS[iDestChunk++] = iChunkPXS[cnt];
-		}
-		else
-		{
-			delete[] Chunk[cnt];
-			Chunk[cnt] = nullptr;
-		}
+		Mat.shrink_to_fit();
+		X.shrink_to_fit(); Y.shrink_to_fit();
+		XDir.shrink_to_fit(); YDir.shrink_to_fit();
+		GfxIndex.shrink_to_fit();
+		Pending.shrink_to_fit();
+		StripeOrder.shrink_to_fit();
 	}
 }
-
-void C4PXSSystem::Delete(C4PXS *pPXS)
-{
-	// find chunk
-	unsigned int cnt;
-	for (cnt = 0; cnt < PXSMaxChunk; cnt++)
-		if (Chunk[cnt] && iChunkPXS[cnt])
-			if (pPXS >= Chunk[cnt] && pPXS < Chunk[cnt] + PXSChunkSize)
-				break;
-	// decrease pxs counter
-	if (cnt < PXSMaxChunk)
-		iChunkPXS[cnt]--;
-}
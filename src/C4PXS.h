@@ -20,8 +20,12 @@
 
 #include <C4Material.h>
 
+#include <vector>
+
+// a single loose pixel; the PXS system stores these split into one array per member
 class C4PXS
 {
+public:
 	C4PXS() : Mat(MNone), x(Fix0), y(Fix0), xdir(Fix0), ydir(Fix0) {}
 
 	friend class C4PXSSystem;
@@ -31,11 +35,16 @@ protected:
 	FIXED x, y, xdir, ydir;
 
 protected:
-	void Execute();
+	void Execute(uint32_t iSeed); // may create PXS; sets Mat to MNone when deactivated
+	bool ExecuteFreeMovement(uint32_t iSeed); // does not change the landscape or other PXS; false if Execute is needed
 	void Deactivate();
+
+private:
+	void ApplyForces(int32_t iX, int32_t iY, uint32_t iSeed, FIXED &rxdir, FIXED &rydir);
 };
 
-const size_t PXSChunkSize = 500, PXSMaxChunk = 20;
+const size_t PXSChunkSize = 500; // PXS per chunk in PXS.c4b
+const int32_t PXSStripeHeight = 32; // landscape rows per stripe PXS are grouped by for parallel execution
 
 class C4PXSSystem
 {
@@ -47,11 +56,16 @@ public:
 	int32_t Count;
 
 protected:
-	C4PXS *Chunk[PXSMaxChunk];
-	size_t iChunkPXS[PXSMaxChunk];
+	// active PXS, densely packed; removing swaps in the last PXS
+	std::vector<int32_t> Mat;
+	std::vector<FIXED> X, Y, XDir, YDir;
+	std::vector<uint16_t> GfxIndex; // graphics variant; not changed when PXS are moved within the arrays
+	std::vector<uint8_t> Pending; // PXS left for the serial pass of Execute
+	std::vector<uint32_t> StripeOrder; // PXS indices sorted by landscape stripe; rebuilt by Execute
+	std::vector<size_t> StripeStart;
+	uint16_t iNextGfxIndex;
 
 public:
-	void Delete(C4PXS *pPXS);
 	void Default();
 	void Clear();
 	void Execute();
@@ -62,7 +76,13 @@ public:
 	bool Create(int32_t mat, FIXED ix, FIXED iy, FIXED ixdir = Fix0, FIXED iydir = Fix0);
 	bool Load(C4Group &hGroup);
 	bool Save(C4Group &hGroup);
+	uint32_t GetChecksum() const; // of the state of all PXS, to compare simulations
 
 protected:
-	C4PXS *New();
+	C4PXS Get(size_t iIndex) const;
+	void Set(size_t iIndex, const C4PXS &rPXS);
+	void Add(const C4PXS &rPXS);
+	void Remove(size_t iIndex);
+	uint32_t GetSeed(uint32_t iSeedBase, size_t iIndex);
+	void SortByStripes();
 };
@@ -528,7 +528,7 @@ void C4Player::PlaceReadyCrew(int32_t tx1, int32_t tx2, int32_t ty, C4Object *Fi
 				C4DebugRecOff DBGRECOFF;
 #endif
 				C4AulParSet parset(C4VInt(Number));
-				nobj->Call(PSF_OnJoinCrew, &parset);
+				nobj->Call(OCB_OnJoinCrew, &parset);
 			}
 		}
 	}
@@ -570,7 +570,7 @@ void C4Player::PlaceReadyCrew(int32_t tx1, int32_t tx2, int32_t ty, C4Object *Fi
 						C4DebugRecOff DbgRecOff;
 #endif
 						C4AulParSet parset(C4VInt(Number));
-						nobj->Call(PSF_OnJoinCrew, &parset);
+						nobj->Call(OCB_OnJoinCrew, &parset);
 					}
 				}
 			}
@@ -868,7 +868,7 @@ C4Object *C4Player::Buy(C4ID id, bool fShowErrors, int32_t iForPlr, C4Object *pB
 		Game.Players.Get(iForPlr)->MakeCrewMember(pThing);
 	// success
 	C4AulParSet parset(C4VInt(Number), C4VObj(pBuyObj));
-	pThing->Call(PSF_Purchase, &parset);
+	pThing->Call(OCB_Purchase, &parset);
 	if (!pThing->Status) return nullptr;
 	return pThing;
 }
@@ -905,7 +905,7 @@ bool C4Player::Sell2Home(C4Object *pObj)
 	}
 	// Remove object, eject any crew members
 	if (pObj->Contained) pObj->Exit();
-	pObj->Call(PSF_Sale, &C4AulParSet(C4VInt(Number)));
+	pObj->Call(OCB_Sale, &C4AulParSet(C4VInt(Number)));
 	pObj->AssignRemoval(true);
 	// Done
 	return true;
@@ -1209,7 +1209,7 @@ bool C4Player::MakeCrewMember(C4Object *pObj, bool fForceInfo, bool fDoCalls)
 	if (fDoCalls)
 	{
 		C4AulParSet parset(C4VInt(Number));
-		pObj->Call(PSF_OnJoinCrew, &parset);
+		pObj->Call(OCB_OnJoinCrew, &parset);
 	}
 
 	return true;
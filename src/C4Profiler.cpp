@@ -0,0 +1,161 @@
+/*
+ * LegacyClonk
+ *
+ * Copyright (c) 2019, The LegacyClonk Team and contributors
+ *
+ * Distributed under the terms of the ISC license; see accompanying file
+ * "COPYING" for details.
+ *
+ * "Clonk" is a registered trademark of Matthes Bender, used with permission.
+ * See accompanying file "TRADEMARK" for details.
+ *
+ * To redistribute this file separately, substitute the full license texts
+ * for the above references.
+ */
+
+// hierarchical zone profiler with trace export
+
+#include <C4Include.h>
+#include <C4Profiler.h>
+
+#include <StdSync.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+	struct C4ProfilerEvent
+	{
+		const char *Name; // nullptr: end of zone
+		uint64_t Time; // nanoseconds since ProfilerEpoch
+		int64_t Value; // counters only
+		bool fCounter;
+	};
+
+	// single writer (the owning thread); readers only while the profiler is disabled
+	struct C4ProfilerThreadBuffer
+	{
+		static constexpr uint64_t Capacity = 1 << 16; // must be a power of two
+
+		C4ProfilerEvent Events[Capacity];
+		std::atomic<uint64_t> WritePos{0}; // total number of events written; the ring holds the last Capacity of them
+		int32_t ThreadID;
+	};
+
+	const auto ProfilerEpoch = std::chrono::steady_clock::now();
+
+	CStdCSec BuffersCSec; // protects Buffers and Names
+	std::vector<std::unique_ptr<C4ProfilerThreadBuffer>> Buffers; // buffers outlive their threads so they can be exported
+	std::unordered_set<std::string> Names;
+
+	thread_local C4ProfilerThreadBuffer *pThreadBuffer = nullptr;
+
+	C4ProfilerThreadBuffer *RegisterThreadBuffer()
+	{
+		CStdLock Lock(&BuffersCSec);
+		auto pBuffer = std::make_unique<C4ProfilerThreadBuffer>();
+		pBuffer->ThreadID = static_cast<int32_t>(Buffers.size()) + 1;
+		Buffers.push_back(std::move(pBuffer));
+		return Buffers.back().get();
+	}
+
+	void WriteJSONString(FILE *pFile, const char *szString)
+	{
+		fputc('"', pFile);
+		for (const char *c = szString; *c; ++c)
+		{
+			if (*c == '"' || *c == '\\')
+				fprintf(pFile, "\\%c", *c);
+			else if (static_cast<unsigned char>(*c) < 0x20)
+				fprintf(pFile, "\\u%04x", static_cast<unsigned int>(static_cast<unsigned char>(*c)));
+			else
+				fputc(*c, pFile);
+		}
+		fputc('"', pFile);
+	}
+
+	void WriteTraceEvent(FILE *pFile, bool &fFirst, const char *szName, uint64_t iTime, int32_t iThreadID, const int64_t *pCounterValue = nullptr)
+	{
+		fputs(fFirst ? "\n" : ",\n", pFile);
+		fFirst = false;
+		// timestamps are given in microseconds
+		fputs("{\"ph\":", pFile);
+		fputs(pCounterValue ? "\"C\",\"name\":" : szName ? "\"B\",\"name\":" : "\"E\"", pFile);
+		if (szName) WriteJSONString(pFile, szName);
+		if (pCounterValue) fprintf(pFile, ",\"args\":{\"value\":%lld}", static_cast<long long>(*pCounterValue));
+		fprintf(pFile, ",\"ts\":%llu.%03u,\"pid\":1,\"tid\":%d}",
+			static_cast<unsigned long long>(iTime / 1000), static_cast<unsigned int>(iTime % 1000), static_cast<int>(iThreadID));
+	}
+}
+
+std::atomic<bool> C4Profiler::Enabled{false};
+
+void C4Profiler::Enable(bool fEnable)
+{
+	Enabled.store(fEnable, std::memory_order_relaxed);
+}
+
+void C4Profiler::Record(const char *szName, int64_t iValue, bool fCounter)
+{
+	C4ProfilerThreadBuffer *pBuffer = pThreadBuffer;
+	if (!pBuffer) pBuffer = pThreadBuffer = RegisterThreadBuffer();
+	const uint64_t iPos = pBuffer->WritePos.load(std::memory_order_relaxed);
+	C4ProfilerEvent &Event = pBuffer->Events[iPos & (C4ProfilerThreadBuffer::Capacity - 1)];
+	Event.Name = szName;
+	Event.Value = iValue;
+	Event.fCounter = fCounter;
+	Event.Time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - ProfilerEpoch).count();
+	pBuffer->WritePos.store(iPos + 1, std::memory_order_release);
+}
+
+const char *C4Profiler::InternName(const char *szName)
+{
+	CStdLock Lock(&BuffersCSec);
+	return Names.emplace(szName).first->c_str();
+}
+
+bool C4Profiler::ExportTrace(const char *szFilename)
+{
+	FILE *pFile = fopen(szFilename, "wb");
+	if (!pFile) return false;
+	fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", pFile);
+	bool fFirst = true;
+	CStdLock Lock(&BuffersCSec);
+	for (const auto &pBuffer : Buffers)
+	{
+		const uint64_t iEnd = pBuffer->WritePos.load(std::memory_order_acquire);
+		const uint64_t iStart = iEnd > C4ProfilerThreadBuffer::Capacity ? iEnd - C4ProfilerThreadBuffer::Capacity : 0;
+		// Zones may have been cut by the ring buffer or by toggling the profiler:
+		// Drop ends of zones that did not begin within the trace and close zones that did not end.
+		int32_t iDepth = 0;
+		uint64_t iLastTime = 0;
+		for (uint64_t i = iStart; i < iEnd; ++i)
+		{
+			const C4ProfilerEvent &Event = pBuffer->Events[i & (C4ProfilerThreadBuffer::Capacity - 1)];
+			if (Event.fCounter)
+			{
+				WriteTraceEvent(pFile, fFirst, Event.Name, Event.Time, pBuffer->ThreadID, &Event.Value);
+				continue;
+			}
+			if (!Event.Name && !iDepth) continue;
+			iDepth += Event.Name ? 1 : -1;
+			iLastTime = Event.Time;
+			WriteTraceEvent(pFile, fFirst, Event.Name, Event.Time, pBuffer->ThreadID);
+		}
+		while (iDepth-- > 0)
+			WriteTraceEvent(pFile, fFirst, nullptr, iLastTime, pBuffer->ThreadID);
+	}
+	fputs("\n]}\n", pFile);
+	return !fclose(pFile);
+}
+
+void C4Profiler::Clear()
+{
+	CStdLock Lock(&BuffersCSec);
+	for (const auto &pBuffer : Buffers)
+		pBuffer->WritePos.store(0, std::memory_order_relaxed);
+}
@@ -0,0 +1,58 @@
+/*
+ * LegacyClonk
+ *
+ * Copyright (c) 2019, The LegacyClonk Team and contributors
+ *
+ * Distributed under the terms of the ISC license; see accompanying file
+ * "COPYING" for details.
+ *
+ * "Clonk" is a registered trademark of Matthes Bender, used with permission.
+ * See accompanying file "TRADEMARK" for details.
+ *
+ * To redistribute this file separately, substitute the full license texts
+ * for the above references.
+ */
+
+// hierarchical zone profiler with trace export
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// While enabled, begin and end events of nested zones are recorded with nanosecond timestamps
+// into a ring buffer per thread. Recording does not lock; only the first event of a thread
+// registers its buffer. Counters record a value at a point in time, e.g. per frame statistics.
+// The recorded events can be exported as Chrome trace event JSON (chrome://tracing, Perfetto, Speedscope).
+class C4Profiler
+{
+public:
+	static bool IsEnabled() { return Enabled.load(std::memory_order_relaxed); }
+	static void Enable(bool fEnable);
+
+	// zone names must stay valid until the trace has been exported - use InternName for temporary strings
+	static void Begin(const char *szName) { if (IsEnabled()) Record(szName); }
+	static void End() { if (IsEnabled()) Record(nullptr); }
+	static void Counter(const char *szName, int64_t iValue) { if (IsEnabled()) Record(szName, iValue, true); }
+	static const char *InternName(const char *szName);
+
+	// both must only be used while the profiler is disabled
+	static bool ExportTrace(const char *szFilename);
+	static void Clear();
+
+private:
+	static std::atomic<bool> Enabled;
+
+	static void Record(const char *szName, int64_t iValue = 0, bool fCounter = false); // nullptr name: end of zone
+};
+
+// profiles the zone of its lifetime
+class C4ProfilerScope
+{
+public:
+	C4ProfilerScope(const char *szName) { C4Profiler::Begin(szName); }
+	~C4ProfilerScope() { C4Profiler::End(); }
+
+	C4ProfilerScope(const C4ProfilerScope &) = delete;
+	C4ProfilerScope &operator=(const C4ProfilerScope &) = delete;
+};
@@ -326,6 +326,8 @@ void C4SLandscape::Default()
 	SkyScrollMode = 0;
 	NewStyleLandscape = 0;
 	FoWRes = CClrModAddMap::iDefResolutionX;
+	SectorSize = 0;
+	MaxPXS = 10000;
 }
 
 void C4SLandscape::GetMapSize(int32_t &rWdt, int32_t &rHgt, int32_t iPlayerNum)
@@ -370,6 +372,8 @@ void C4SLandscape::CompileFunc(StdCompiler *pComp)
 	pComp->Value(mkNamingAdapt(SkyScrollMode,             "SkyScrollMode",     0));
 	pComp->Value(mkNamingAdapt(NewStyleLandscape,         "NewStyleLandscape", false));
 	pComp->Value(mkNamingAdapt(FoWRes,                    "FoWRes",            static_cast<int32_t>(CClrModAddMap::iDefResolutionX)));
+	pComp->Value(mkNamingAdapt(SectorSize,                "SectorSize",        0));
+	pComp->Value(mkNamingAdapt(MaxPXS,                    "MaxPXS",            10000));
 }
 
 void C4SWeather::Default()
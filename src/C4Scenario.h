@@ -236,6 +236,8 @@ public:
 	int32_t SkyScrollMode; // sky scrolling mode for newgfx
 	int32_t NewStyleLandscape; // if set to 2, the landscape uses up to 125 mat/texture pairs
 	int32_t FoWRes; // chunk size of FoGOfWar
+	int32_t SectorSize; // size of the object search sectors in px; 0 for automatic
+	int32_t MaxPXS; // maximum number of loose material pixels
 
 public:
 	void Default();
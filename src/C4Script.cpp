@@ -5423,8 +5423,8 @@ static bool FnFightWith(C4AulContext *ctx, C4Object *pTarget, C4Object *pClonk)
 	// RejectFight callback
 	C4AulParSet parset1(C4VObj(pTarget));
 	C4AulParSet parset2(C4VObj(pClonk));
-	if (pTarget->Call(PSF_RejectFight, &parset1).getBool()) return false;
-	if (pClonk->Call(PSF_RejectFight, &parset2).getBool()) return false;
+	if (pTarget->Call(OCB_RejectFight, &parset1).getBool()) return false;
+	if (pClonk->Call(OCB_RejectFight, &parset2).getBool()) return false;
 	// begin fighting
 	ObjectActionFight(pClonk, pTarget);
 	ObjectActionFight(pTarget, pClonk);
@@ -6944,6 +6944,60 @@ void InitFunctionMap(C4AulScriptEngine *pEngine)
 	new C4AulDefCastFunc(pEngine, "CastAny",       C4V_Any,  C4V_Any);
 }
 
+// PSF_-names of C4ObjectCallback
+const char *const C4ObjectCallbackNames[OCB_Count] =
+{
+	PSF_Initialize,
+	PSF_Construction,
+	PSF_Destruction,
+	PSF_ContentsDestruction,
+	PSF_Hit,
+	PSF_Hit2,
+	PSF_Hit3,
+	PSF_Grab,
+	PSF_Grabbed,
+	PSF_Put,
+	PSF_Collection,
+	PSF_Collection2,
+	PSF_Ejection,
+	PSF_Entrance,
+	PSF_Departure,
+	PSF_Completion,
+	PSF_Purchase,
+	PSF_Sale,
+	PSF_Damage,
+	PSF_Incineration,
+	PSF_IncinerationEx,
+	PSF_Death,
+	PSF_ActivateEntrance,
+	PSF_Activate,
+	PSF_LiftTop,
+	PSF_ControlUpdate,
+	PSF_ContainedControlUpdate,
+	PSF_ControlCommand,
+	PSF_ControlCommandFinished,
+	PSF_DeepBreath,
+	PSF_CatchBlow,
+	PSF_QueryCatchBlow,
+	PSF_Stuck,
+	PSF_RejectCollection,
+	PSF_RejectContents,
+	PSF_GrabLost,
+	PSF_LineBreak,
+	PSF_BuildNeedsMaterial,
+	PSF_UpdateTransferZone,
+	PSF_MenuQueryCancel,
+	PSF_RejectEntrance,
+	PSF_RejectFight,
+	PSF_AttachTargetLost,
+	PSF_CrewSelection,
+	PSF_MenuSelection,
+	PSF_OnActionJump,
+	PSF_OnOwnerChanged,
+	PSF_OnJoinCrew,
+	PSF_FireMode,
+};
+
 C4ScriptConstDef C4ScriptConstMap[] =
 {
 	{ "C4D_All",         C4V_Int, C4D_All },
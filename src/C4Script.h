@@ -148,3 +148,61 @@ void InitFunctionMap(C4AulScriptEngine *pEngine); // add functions to engine
 // an additional callback for Construct.
 #define PSF_ControlCommandAcquire      "~ControlCommandAcquire" // C4Object *pTarget (unused), int iRangeX, int iRangeY, C4Object *pExcludeContainer, C4ID idAcquireDef
 #define PSF_ControlCommandConstruction "~ControlCommandConstruction" // C4Object *pTarget (unused), int iRangeX, int iRangeY, C4Object *pTarget2 (unused), C4ID idConstructDef
+
+// engine callbacks to objects that are resolved once per definition after linking (see C4DefScriptHost::AfterLink)
+enum C4ObjectCallback
+{
+	OCB_Initialize,
+	OCB_Construction,
+	OCB_Destruction,
+	OCB_ContentsDestruction,
+	OCB_Hit,
+	OCB_Hit2,
+	OCB_Hit3,
+	OCB_Grab,
+	OCB_Grabbed,
+	OCB_Put,
+	OCB_Collection,
+	OCB_Collection2,
+	OCB_Ejection,
+	OCB_Entrance,
+	OCB_Departure,
+	OCB_Completion,
+	OCB_Purchase,
+	OCB_Sale,
+	OCB_Damage,
+	OCB_Incineration,
+	OCB_IncinerationEx,
+	OCB_Death,
+	OCB_ActivateEntrance,
+	OCB_Activate,
+	OCB_LiftTop,
+	OCB_ControlUpdate,
+	OCB_ContainedControlUpdate,
+	OCB_ControlCommand,
+	OCB_ControlCommandFinished,
+	OCB_DeepBreath,
+	OCB_CatchBlow,
+	OCB_QueryCatchBlow,
+	OCB_Stuck,
+	OCB_RejectCollection,
+	OCB_RejectContents,
+	OCB_GrabLost,
+	OCB_LineBreak,
+	OCB_BuildNeedsMaterial,
+	OCB_UpdateTransferZone,
+	OCB_MenuQueryCancel,
+	OCB_RejectEntrance,
+	OCB_RejectFight,
+	OCB_AttachTargetLost,
+	OCB_CrewSelection,
+	OCB_MenuSelection,
+	OCB_OnActionJump,
+	OCB_OnOwnerChanged,
+	OCB_OnJoinCrew,
+	OCB_FireMode,
+
+	OCB_Count
+};
+
+extern const char *const C4ObjectCallbackNames[OCB_Count]; // PSF_-names of the callbacks above
@@ -189,6 +189,7 @@ void C4DefScriptHost::Default()
 {
 	C4ScriptHost::Default();
 	SFn_CalcValue = SFn_SellTo = SFn_ControlTransfer = SFn_CustomComponents = nullptr;
+	std::fill(SFn_Callbacks, std::end(SFn_Callbacks), nullptr);
 	ControlMethod[0] = ControlMethod[1] = ContainedControlMethod[0] = ContainedControlMethod[1] = ActivationControlMethod[0] = ActivationControlMethod[1] = 0;
 }
 
@@ -201,6 +202,8 @@ void C4DefScriptHost::AfterLink()
 	SFn_SellTo           = GetSFunc(PSF_SellTo,              AA_PROTECTED);
 	SFn_ControlTransfer  = GetSFunc(PSF_ControlTransfer,     AA_PROTECTED);
 	SFn_CustomComponents = GetSFunc(PSF_GetCustomComponents, AA_PROTECTED);
+	for (int32_t i = 0; i < OCB_Count; ++i)
+		SFn_Callbacks[i] = GetSFunc(C4ObjectCallbackNames[i]);
 	if (Def)
 	{
 		C4AulAccess CallAccess = AA_PRIVATE;
@@ -77,6 +77,7 @@ public:
 	C4AulScriptFunc *SFn_SellTo; // player par(0) sold the object
 	C4AulScriptFunc *SFn_ControlTransfer; // object par(0) tries to get to par(1)/par(2)
 	C4AulScriptFunc *SFn_CustomComponents; // PSF_GetCustomComponents
+	C4AulScriptFunc *SFn_Callbacks[OCB_Count]; // engine callbacks to objects; nullptr if not implemented
 	int32_t ControlMethod[2], ContainedControlMethod[2], ActivationControlMethod[2];
 };
 
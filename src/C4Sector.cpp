@@ -52,20 +52,42 @@ void C4LSector::CompileFunc(StdCompiler *pComp)
 
 /* sector map */
 
-void C4LSectors::Init(int iWdt, int iHgt)
+void C4LSectors::Init(int iWdt, int iHgt, int iSectorSize)
 {
 	// clear any previous initialization
 	Clear();
+	// sector size: given or the default, enlarged for huge maps
+	if (iSectorSize > 0)
+		SctWdt = SctHgt = iSectorSize;
+	else
+		for (SctWdt = C4LSectorWdt, SctHgt = C4LSectorHgt;
+			((iWdt - 1) / SctWdt + 1) * ((iHgt - 1) / SctHgt + 1) > C4LSectorMaxCount;
+			SctWdt *= 2, SctHgt *= 2);
 	// store class members, calc size
-	Wdt = ((PxWdt = iWdt) - 1) / C4LSectorWdt + 1;
-	Hgt = ((PxHgt = iHgt) - 1) / C4LSectorHgt + 1;
+	Wdt = ((PxWdt = iWdt) - 1) / SctWdt + 1;
+	Hgt = ((PxHgt = iHgt) - 1) / SctHgt + 1;
 	// create sectors
 	Sectors = new C4LSector[Size = Wdt * Hgt];
+	// create coarse grid
+	BlockWdt = (Wdt - 1) / C4LSectorBlockSize + 1;
+	BlockHgt = (Hgt - 1) / C4LSectorBlockSize + 1;
+	Blocks = new C4LSectorBlock[BlockWdt * BlockHgt];
+	for (int cnt = 0; cnt < BlockWdt * BlockHgt; cnt++)
+	{
+		Blocks[cnt].Objects = Blocks[cnt].ObjectShapes = 0;
+		Blocks[cnt].x2 = std::min((cnt % BlockWdt + 1) * C4LSectorBlockSize, Wdt) - 1;
+	}
+	BlockOut.Objects = BlockOut.ObjectShapes = 0;
+	BlockOut.x2 = -1;
 	// init sectors
 	C4LSector *sct = Sectors;
 	for (int cnt = 0; cnt < Size; cnt++, sct++)
+	{
 		sct->Init(cnt % Wdt, cnt / Wdt);
+		sct->pBlock = Blocks + (sct->y / C4LSectorBlockSize) * BlockWdt + sct->x / C4LSectorBlockSize;
+	}
 	SectorOut.Init(-1, -1); // outpos at -1,-1 - MUST NOT intersect with an inside sector!
+	SectorOut.pBlock = &BlockOut;
 }
 
 void C4LSectors::Clear()
@@ -74,6 +96,7 @@ void C4LSectors::Clear()
 	SectorOut.Clear();
 	// free sectors
 	delete[] Sectors; Sectors = nullptr;
+	delete[] Blocks; Blocks = nullptr;
 }
 
 C4LSector *C4LSectors::SectorAt(int ix, int iy)
@@ -82,7 +105,7 @@ C4LSector *C4LSectors::SectorAt(int ix, int iy)
 	if (ix < 0 || iy < 0 || ix >= PxWdt || iy >= PxHgt)
 		return &SectorOut;
 	// get sector
-	return Sectors + (iy / C4LSectorHgt) * Wdt + (ix / C4LSectorWdt);
+	return Sectors + (iy / SctHgt) * Wdt + (ix / SctWdt);
 }
 
 void C4LSectors::Add(C4Object *pObj, C4ObjectList *pMainList)
@@ -90,14 +113,14 @@ void C4LSectors::Add(C4Object *pObj, C4ObjectList *pMainList)
 	assert(Sectors);
 	// Add to owning sector
 	C4LSector *pSct = SectorAt(pObj->x, pObj->y);
-	pSct->Objects.Add(pObj, C4ObjectList::stMain, pMainList);
+	pSct->AddObject(pObj, pMainList);
 	// Save position
 	pObj->old_x = pObj->x; pObj->old_y = pObj->y;
 	// Add to all sectors in shape area
 	pObj->Area.Set(this, pObj);
 	for (pSct = pObj->Area.First(); pSct; pSct = pObj->Area.Next(pSct))
 	{
-		pSct->ObjectShapes.Add(pObj, C4ObjectList::stMain, pMainList);
+		pSct->AddObjectShape(pObj, pMainList);
 	}
 #ifdef DEBUGREC
 	pObj->Area.DebugRec(pObj, 'A');
@@ -121,8 +144,8 @@ void C4LSectors::Update(C4Object *pObj, C4ObjectList *pMainList)
 		pNew = SectorAt(pObj->x, pObj->y);
 		if (pOld != pNew)
 		{
-			pOld->Objects.Remove(pObj);
-			pNew->Objects.Add(pObj, C4ObjectList::stMain, pMainList);
+			pOld->RemoveObject(pObj);
+			pNew->AddObject(pObj, pMainList);
 		}
 		// Save position
 		pObj->old_x = pObj->x; pObj->old_y = pObj->y;
@@ -133,12 +156,12 @@ void C4LSectors::Update(C4Object *pObj, C4ObjectList *pMainList)
 	// Remove from all old sectors in shape area
 	for (pOld = pObj->Area.First(); pOld; pOld = pObj->Area.Next(pOld))
 		if (!NewArea.Contains(pOld))
-			pOld->ObjectShapes.Remove(pObj);
+			pOld->RemoveObjectShape(pObj);
 	// Add to all new sectors in shape area
 	for (pNew = NewArea.First(); pNew; pNew = NewArea.Next(pNew))
 		if (!pObj->Area.Contains(pNew))
 		{
-			pNew->ObjectShapes.Add(pObj, C4ObjectList::stMain, pMainList);
+			pNew->AddObjectShape(pObj, pMainList);
 		}
 	// Update area
 	pObj->Area = NewArea;
@@ -152,7 +175,7 @@ void C4LSectors::Remove(C4Object *pObj)
 	assert(Sectors); assert(pObj);
 	// Remove from owning sector
 	C4LSector *pSct = SectorAt(pObj->old_x, pObj->old_y);
-	if (!pSct->Objects.Remove(pObj))
+	if (!pSct->RemoveObject(pObj))
 	{
 #ifdef _DEBUG
 		LogF("WARNING: Object %d of type %s deleted but not found in pos sector list!", pObj->Number, C4IdText(pObj->id));
@@ -160,23 +183,23 @@ void C4LSectors::Remove(C4Object *pObj)
 		// if it was not found in owning sector, it must be somewhere else. yeah...
 		bool fFound = false;
 		for (pSct = pObj->Area.First(); pSct; pSct = pObj->Area.Next(pSct))
-			if (pSct->Objects.Remove(pObj)) { fFound = true; break; }
+			if (pSct->RemoveObject(pObj)) { fFound = true; break; }
 		// yukh, somewhere else entirely...
 		if (!fFound)
 		{
-			fFound = !!SectorOut.Objects.Remove(pObj);
+			fFound = SectorOut.RemoveObject(pObj);
 			if (!fFound)
 			{
 				pSct = Sectors;
 				for (int cnt = 0; cnt < Size; cnt++, pSct++)
-					if (pSct->Objects.Remove(pObj)) { fFound = true; break; }
+					if (pSct->RemoveObject(pObj)) { fFound = true; break; }
 			}
 			assert(fFound);
 		}
 	}
 	// Remove from all sectors in shape area
 	for (pSct = pObj->Area.First(); pSct; pSct = pObj->Area.Next(pSct))
-		pSct->ObjectShapes.Remove(pObj);
+		pSct->RemoveObjectShape(pObj);
 #ifdef DEBUGREC
 	pObj->Area.DebugRec(pObj, 'R');
 #endif
@@ -249,10 +272,10 @@ void C4LArea::Set(C4LSectors *pSectors, const C4Rect &Rect)
 	if (!ClippedRect.Wdt) ClippedRect.Wdt = 1;
 	if (!ClippedRect.Hgt) ClippedRect.Hgt = 1;
 	// calc bounds
-	xL = (ClippedRect.x + ClippedRect.Wdt - 1) / C4LSectorWdt;
-	yL = (ClippedRect.y + ClippedRect.Hgt - 1) / C4LSectorHgt;
+	xL = (ClippedRect.x + ClippedRect.Wdt - 1) / pSectors->SctWdt;
+	yL = (ClippedRect.y + ClippedRect.Hgt - 1) / pSectors->SctHgt;
 	// calc pitch
-	dpitch = pSectors->Wdt - (ClippedRect.x + ClippedRect.Wdt - 1) / C4LSectorWdt + ClippedRect.x / C4LSectorWdt;
+	dpitch = pSectors->Wdt - (ClippedRect.x + ClippedRect.Wdt - 1) / pSectors->SctWdt + ClippedRect.x / pSectors->SctWdt;
 }
 
 void C4LArea::Set(C4LSectors *pSectors, C4Object *pObj)
@@ -276,6 +299,15 @@ C4LSector *C4LArea::Next(C4LSector *pPrev) const
 	return pOut;
 }
 
+C4LSector *C4LArea::NextBlock(C4LSector *pPrev) const
+{
+	// the outside-sector has no neighbours
+	if (pPrev == pOut)
+		return nullptr;
+	// skip to the last sector of the block within the current line
+	return Next(pPrev + std::min(pPrev->pBlock->x2, xL) - pPrev->x);
+}
+
 bool C4LArea::Contains(C4LSector *pSct) const
 {
 	assert(pSct);
@@ -295,6 +327,9 @@ C4ObjectList *C4LArea::NextObjects(C4ObjectList *pPrev, C4LSector **ppSct)
 		*ppSct = First();
 	else
 		*ppSct = Next(*ppSct);
+	// skip blocks without objects
+	while (*ppSct && *ppSct != pOut && !(*ppSct)->pBlock->Objects)
+		*ppSct = NextBlock(*ppSct);
 	// nothing left?
 	if (!*ppSct)
 		return nullptr;
@@ -309,6 +344,9 @@ C4ObjectList *C4LArea::NextObjectShapes(C4ObjectList *pPrev, C4LSector **ppSct)
 		*ppSct = First();
 	else
 		*ppSct = Next(*ppSct);
+	// skip blocks without object shapes
+	while (*ppSct && *ppSct != pOut && !(*ppSct)->pBlock->ObjectShapes)
+		*ppSct = NextBlock(*ppSct);
 	// nothing left?
 	if (!*ppSct)
 		return nullptr;
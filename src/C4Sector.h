@@ -27,8 +27,17 @@ class C4LSectors;
 class C4LArea;
 
 // constants
-const int32_t C4LSectorWdt = 50,
-              C4LSectorHgt = 50;
+const int32_t C4LSectorWdt = 50, // default sector size
+              C4LSectorHgt = 50,
+              C4LSectorMaxCount = 4096, // automatic sector sizes grow until the map has no more sectors than this
+              C4LSectorBlockSize = 8; // sectors per side of the coarse grid blocks
+
+// block of sectors in the coarse grid; counts the object list entries of its sectors
+struct C4LSectorBlock
+{
+	int32_t Objects, ObjectShapes;
+	int x2; // last sector column of the block
+};
 
 // one of those object list sectors
 class C4LSector
@@ -46,9 +55,17 @@ public:
 
 	C4ObjectList Objects; // objects within this sector
 	C4ObjectList ObjectShapes; // objects with shapes that overlap this sector
+	C4LSectorBlock *pBlock; // block of the coarse grid containing this sector
 
 	void CompileFunc(StdCompiler *pComp);
 
+protected:
+	// list manipulation keeping the block counts
+	void AddObject(C4Object *pObj, C4ObjectList *pMainList) { if (Objects.Add(pObj, C4ObjectList::stMain, pMainList)) ++pBlock->Objects; }
+	bool RemoveObject(C4Object *pObj) { if (!Objects.Remove(pObj)) return false; --pBlock->Objects; return true; }
+	void AddObjectShape(C4Object *pObj, C4ObjectList *pMainList) { if (ObjectShapes.Add(pObj, C4ObjectList::stMain, pMainList)) ++pBlock->ObjectShapes; }
+	void RemoveObjectShape(C4Object *pObj) { if (ObjectShapes.Remove(pObj)) --pBlock->ObjectShapes; }
+
 	friend class C4LSectors;
 };
 
@@ -58,12 +75,19 @@ class C4LSectors
 public:
 	C4LSector *Sectors; // mem holding the sector array
 	int PxWdt, PxHgt; // size in px
+	int SctWdt, SctHgt; // sector size in px
 	int Wdt, Hgt, Size; // sector count
 
+	C4LSectorBlock *Blocks; // coarse grid
+	int BlockWdt, BlockHgt; // block count
+	C4LSectorBlock BlockOut; // block of the sector "outside"
+
 	C4LSector SectorOut; // the sector "outside"
 
 public:
-	void Init(int Wdt, int Hgt); // init map sectors
+	C4LSectors() : Sectors(nullptr), Blocks(nullptr) {}
+
+	void Init(int Wdt, int Hgt, int iSectorSize = 0); // init map sectors; automatic sector size if zero
 	void Clear(); // free map sectors
 	C4LSector *SectorAt(int ix, int iy); // get sector at pos
 
@@ -115,6 +139,7 @@ public:
 
 	C4LSector *First() const { return pFirst; } // get first sector
 	C4LSector *Next(C4LSector *pPrev) const; // get next sector within area
+	C4LSector *NextBlock(C4LSector *pPrev) const; // get first sector of the next block within area
 
 	bool Contains(C4LSector *pSct) const; // return whether sector is contained in area
 
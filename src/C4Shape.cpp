@@ -527,9 +527,10 @@ bool C4Shape::CheckContact(int32_t cx, int32_t cy)
 
 #ifdef C4ENGINE
 
+	const int32_t iPlanes = Game.Landscape.GetDensityPlanes(ContactDensity, INT32_MAX);
 	for (int32_t cvtx = 0; cvtx < VtxNum; cvtx++)
 		if (!(VtxCNAT[cvtx] & CNAT_NoCollision))
-			if (GBackDensity(cx + VtxX[cvtx], cy + VtxY[cvtx]) >= ContactDensity)
+			if (Game.Landscape.InDensityRange(iPlanes, ContactDensity, INT32_MAX, cx + VtxX[cvtx], cy + VtxY[cvtx]))
 				return true;
 
 #endif
@@ -548,6 +549,7 @@ bool C4Shape::ContactCheck(int32_t cx, int32_t cy)
 
 	ContactCNAT = CNAT_None;
 	ContactCount = 0;
+	const int32_t iPlanes = Game.Landscape.GetDensityPlanes(ContactDensity, INT32_MAX);
 
 	for (int32_t cvtx = 0; cvtx < VtxNum; cvtx++)
 
@@ -558,19 +560,19 @@ bool C4Shape::ContactCheck(int32_t cx, int32_t cy)
 			VtxContactCNAT[cvtx] = CNAT_None;
 			VtxContactMat[cvtx] = GBackMat(cx + VtxX[cvtx], cy + VtxY[cvtx]);
 
-			if (GBackDensity(cx + VtxX[cvtx], cy + VtxY[cvtx]) >= ContactDensity)
+			if (Game.Landscape.InDensityRange(iPlanes, ContactDensity, INT32_MAX, cx + VtxX[cvtx], cy + VtxY[cvtx]))
 			{
 				ContactCNAT |= VtxCNAT[cvtx];
 				VtxContactCNAT[cvtx] |= CNAT_Center;
 				ContactCount++;
 				// Vertex center contact, now check top,bottom,left,right
-				if (GBackDensity(cx + VtxX[cvtx], cy + VtxY[cvtx] - 1) >= ContactDensity)
+				if (Game.Landscape.InDensityRange(iPlanes, ContactDensity, INT32_MAX, cx + VtxX[cvtx], cy + VtxY[cvtx] - 1))
 					VtxContactCNAT[cvtx] |= CNAT_Top;
-				if (GBackDensity(cx + VtxX[cvtx], cy + VtxY[cvtx] + 1) >= ContactDensity)
+				if (Game.Landscape.InDensityRange(iPlanes, ContactDensity, INT32_MAX, cx + VtxX[cvtx], cy + VtxY[cvtx] + 1))
 					VtxContactCNAT[cvtx] |= CNAT_Bottom;
-				if (GBackDensity(cx + VtxX[cvtx] - 1, cy + VtxY[cvtx]) >= ContactDensity)
+				if (Game.Landscape.InDensityRange(iPlanes, ContactDensity, INT32_MAX, cx + VtxX[cvtx] - 1, cy + VtxY[cvtx]))
 					VtxContactCNAT[cvtx] |= CNAT_Left;
-				if (GBackDensity(cx + VtxX[cvtx] + 1, cy + VtxY[cvtx]) >= ContactDensity)
+				if (Game.Landscape.InDensityRange(iPlanes, ContactDensity, INT32_MAX, cx + VtxX[cvtx] + 1, cy + VtxY[cvtx]))
 					VtxContactCNAT[cvtx] |= CNAT_Right;
 			}
 		}
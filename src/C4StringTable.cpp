@@ -79,12 +79,16 @@ void C4String::Reg(C4StringTable *pnTable)
 	pnTable->Last = this;
 
 	pTable = pnTable;
+
+	pTable->AddToIndex(this);
 }
 
 void C4String::UnReg()
 {
 	if (!pTable) return;
 
+	pTable->RemoveFromIndex(this);
+
 	if (Next)
 		Next->Prev = Prev;
 	else
@@ -156,6 +160,51 @@ int C4StringTable::EnumStrings()
 	return iCurrID;
 }
 
+void C4StringTable::AddToIndex(C4String *pString)
+{
+	pString->NextSame = pString->PrevSame = nullptr;
+	// strings without data never compare equal to anything
+	if (!pString->Data.getData()) return;
+	// add string to tail of its contents chain
+	const auto [it, inserted] = Index.try_emplace(pString->Data.getData(), IndexEntry{pString, pString});
+	if (inserted) return;
+	pString->PrevSame = it->second.Last;
+	it->second.Last->NextSame = pString;
+	it->second.Last = pString;
+}
+
+void C4StringTable::RemoveFromIndex(C4String *pString)
+{
+	if (!pString->Data.getData()) return;
+	if (pString->PrevSame && pString->NextSame)
+	{
+		pString->PrevSame->NextSame = pString->NextSame;
+		pString->NextSame->PrevSame = pString->PrevSame;
+	}
+	else
+	{
+		const auto it = Index.find(pString->Data.getData());
+		if (pString->PrevSame)
+		{
+			pString->PrevSame->NextSame = nullptr;
+			it->second.Last = pString->PrevSame;
+		}
+		else
+		{
+			// first of chain: the key refers to this string's data, so re-key it to the successor
+			C4String *const pNext = pString->NextSame;
+			C4String *const pLast = it->second.Last;
+			Index.erase(it);
+			if (pNext)
+			{
+				pNext->PrevSame = nullptr;
+				Index.emplace(pNext->Data.getData(), IndexEntry{pNext, pLast});
+			}
+		}
+	}
+	pString->NextSame = pString->PrevSame = nullptr;
+}
+
 C4String *C4StringTable::RegString(const char *strString)
 {
 	return new C4String(strString, this);
@@ -163,10 +212,9 @@ C4String *C4StringTable::RegString(const char *strString)
 
 C4String *C4StringTable::FindString(const char *strString)
 {
-	for (C4String *pAct = First; pAct; pAct = pAct->Next)
-		if (SEqual(pAct->Data.getData(), strString))
-			return pAct;
-	return nullptr;
+	if (!strString) return nullptr;
+	const auto it = Index.find(strString);
+	return it != Index.end() ? it->second.First : nullptr;
 }
 
 C4String *C4StringTable::FindString(C4String *pString)
@@ -187,9 +235,9 @@ C4String *C4StringTable::FindString(int iEnumID)
 
 C4String *C4StringTable::FindSaveString(C4String *pString)
 {
-	for (C4String *pAct = First; pAct; pAct = pAct->Next)
+	for (C4String *pAct = FindString(pString->Data.getData()); pAct; pAct = pAct->NextSame)
 	{
-		if (SEqual(pAct->Data.getData(), pString->Data.getData()) && (!pAct->Hold || pAct->iRefCnt))
+		if (!pAct->Hold || pAct->iRefCnt)
 		{
 			return pAct;
 		}
@@ -18,6 +18,9 @@
 
 #pragma once
 
+#include <string_view>
+#include <unordered_map>
+
 class C4StringTable;
 class C4Group;
 
@@ -39,6 +42,7 @@ public:
 	int iEnumID;
 
 	C4String *Next, *Prev; // double-linked list
+	C4String *NextSame, *PrevSame; // double-linked list of strings with equal contents, in list order
 
 	C4StringTable *pTable; // owning table
 
@@ -66,4 +70,18 @@ public:
 	bool Save(C4Group &ParentGroup);
 
 	C4String *First, *Last; // string list
+
+private:
+	struct IndexEntry
+	{
+		C4String *First, *Last; // chain of strings with equal contents
+	};
+
+	// index of all strings by contents; keys refer to the data of the chain's first string
+	std::unordered_map<std::string_view, IndexEntry> Index;
+
+	void AddToIndex(C4String *pString);
+	void RemoveFromIndex(C4String *pString);
+
+	friend class C4String;
 };
@@ -22,6 +22,8 @@
 
 class C4Group;
 
+class StdBitmap;
+
 class C4Surface : public CSurface
 {
 private:
@@ -37,5 +39,6 @@ public:
 	bool SavePNG(C4Group &hGroup, const char *szFilename, bool fSaveAlpha = true, bool fApplyGamma = false, bool fSaveOverlayOnly = false);
 	bool Copy(C4Surface &fromSfc);
 	bool ReadPNG(CStdStream &hGroup);
+	bool ReadBitmap(const StdBitmap &bmp); // create from an already decoded image
 	bool ReadJPEG(CStdStream &hGroup);
 };
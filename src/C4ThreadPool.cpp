@@ -0,0 +1,117 @@
+/*
+ * LegacyClonk
+ *
+ * Copyright (c) 2019, The LegacyClonk Team and contributors
+ *
+ * Distributed under the terms of the ISC license; see accompanying file
+ * "COPYING" for details.
+ *
+ * "Clonk" is a registered trademark of Matthes Bender, used with permission.
+ * See accompanying file "TRADEMARK" for details.
+ *
+ * To redistribute this file separately, substitute the full license texts
+ * for the above references.
+ */
+
+// worker threads for data-parallel engine tasks
+
+#include <C4Include.h>
+#include <C4ThreadPool.h>
+
+#include <C4Config.h>
+
+#include <algorithm>
+
+namespace
+{
+	const int32_t C4ThreadPoolMaxThreads = 64;
+}
+
+void C4ThreadPool::Clear()
+{
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		fStop = true;
+	}
+	WorkAvailable.notify_all();
+	for (auto &Worker : Workers)
+		Worker.join();
+	Workers.clear();
+	fStop = false;
+}
+
+void C4ThreadPool::SetThreadCount(int32_t iCount)
+{
+	Clear();
+	if (iCount <= 0) iCount = static_cast<int32_t>(std::thread::hardware_concurrency());
+	iThreadCount = std::clamp<int32_t>(iCount, 1, C4ThreadPoolMaxThreads);
+}
+
+int32_t C4ThreadPool::GetThreadCount()
+{
+	if (iThreadCount < 0) SetThreadCount(Config.General.WorkerThreads);
+	return iThreadCount;
+}
+
+void C4ThreadPool::Start()
+{
+	// the calling thread works as well
+	const uint64_t iStartGeneration = iGeneration;
+	for (int32_t i = 1; i < GetThreadCount(); ++i)
+		Workers.emplace_back(&C4ThreadPool::WorkerFunc, this, iStartGeneration);
+}
+
+void C4ThreadPool::ParallelFor(size_t iCount, const std::function<void(size_t)> &fnTask)
+{
+	if (!iCount) return;
+	if (Workers.empty() && GetThreadCount() > 1) Start();
+	// nothing to distribute?
+	if (Workers.empty() || iCount == 1 || fRunning.exchange(true))
+	{
+		for (size_t i = 0; i < iCount; ++i)
+			fnTask(i);
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		pTask = &fnTask;
+		iTaskCount = iCount;
+		iNextIndex.store(0, std::memory_order_relaxed);
+		iBusyWorkers = Workers.size();
+		++iGeneration;
+	}
+	WorkAvailable.notify_all();
+	RunTasks();
+	{
+		std::unique_lock<std::mutex> Lock(Mutex);
+		WorkDone.wait(Lock, [this] { return !iBusyWorkers; });
+		pTask = nullptr;
+	}
+	fRunning = false;
+}
+
+void C4ThreadPool::WorkerFunc(uint64_t iStartGeneration)
+{
+	uint64_t iDoneGeneration = iStartGeneration;
+	for (;;)
+	{
+		{
+			std::unique_lock<std::mutex> Lock(Mutex);
+			WorkAvailable.wait(Lock, [&] { return fStop || iGeneration != iDoneGeneration; });
+			if (fStop) return;
+			iDoneGeneration = iGeneration;
+		}
+		RunTasks();
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			if (!--iBusyWorkers) WorkDone.notify_one();
+		}
+	}
+}
+
+void C4ThreadPool::RunTasks()
+{
+	// task and count are only changed while no worker is busy
+	for (size_t i; (i = iNextIndex.fetch_add(1, std::memory_order_relaxed)) < iTaskCount; )
+		(*pTask)(i);
+}
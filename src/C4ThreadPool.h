@@ -0,0 +1,69 @@
+/*
+ * LegacyClonk
+ *
+ * Copyright (c) 2019, The LegacyClonk Team and contributors
+ *
+ * Distributed under the terms of the ISC license; see accompanying file
+ * "COPYING" for details.
+ *
+ * "Clonk" is a registered trademark of Matthes Bender, used with permission.
+ * See accompanying file "TRADEMARK" for details.
+ *
+ * To redistribute this file separately, substitute the full license texts
+ * for the above references.
+ */
+
+// worker threads for data-parallel engine tasks
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Runs the iterations of a loop on a fixed set of worker threads and the calling thread.
+// Workers are started on first use and wait for work in between, so short per-frame tasks
+// do not pay for thread creation. Meant to be used from the main thread only.
+class C4ThreadPool
+{
+public:
+	C4ThreadPool() = default;
+	~C4ThreadPool() { Clear(); }
+	C4ThreadPool(const C4ThreadPool &) = delete;
+	C4ThreadPool &operator=(const C4ThreadPool &) = delete;
+
+	void Clear(); // stop all workers; they are started again as needed
+
+	// number of threads running tasks including the calling thread
+	// 0 uses one thread per hardware thread, 1 runs all tasks on the calling thread
+	void SetThreadCount(int32_t iCount);
+	int32_t GetThreadCount();
+
+	// Calls fnTask(i) for every i in [0, iCount) and returns when all calls have finished.
+	// The calls run concurrently and in no particular order, so they must not depend on each other.
+	// Nested calls from within a task are run on the calling thread.
+	void ParallelFor(size_t iCount, const std::function<void(size_t)> &fnTask);
+
+private:
+	std::vector<std::thread> Workers;
+	int32_t iThreadCount = -1; // -1: not determined yet
+
+	std::mutex Mutex; // protects everything below except iNextIndex
+	std::condition_variable WorkAvailable, WorkDone;
+	const std::function<void(size_t)> *pTask = nullptr;
+	size_t iTaskCount = 0;
+	std::atomic<size_t> iNextIndex{0};
+	size_t iBusyWorkers = 0;
+	uint64_t iGeneration = 0; // increased for every ParallelFor, so workers do not run a loop twice
+	bool fStop = false;
+
+	std::atomic<bool> fRunning{false};
+
+	void Start();
+	void WorkerFunc(uint64_t iStartGeneration);
+	void RunTasks();
+};
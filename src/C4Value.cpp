@@ -37,11 +37,13 @@ const C4Value C4VFalse = C4VBool(false);
 C4Value::~C4Value()
 {
 	// resolve all C4Values referencing this Value
-	while (FirstRef)
-		FirstRef->Set(*this);
+	while (C4Value *pRef = GetFirstRef())
+		pRef->Set(*this);
 
 	// delete contents
-	DelDataRef(Data, Type, GetNextRef(), GetBaseContainer());
+	DelDataRef(Data, Type, GetPrevRef(), GetNextRef(), GetBaseContainer());
+
+	delete Links;
 }
 
 StdStrBuf C4Value::toString() const
@@ -103,18 +105,18 @@ void C4Value::AddDataRef()
 	}
 }
 
-void C4Value::DelDataRef(C4V_Data Data, C4V_Type Type, C4Value *pNextRef, C4ValueContainer *pBaseContainer)
+void C4Value::DelDataRef(C4V_Data Data, C4V_Type Type, C4Value *pPrevRef, C4Value *pNextRef, C4ValueContainer *pBaseContainer)
 {
 	// clean up
 	switch (Type)
 	{
 	case C4V_pC4Value:
 		// Save because AddDataRef does not set this flag
-		HasBaseContainer = false;
-		Data.Ref->DelRef(this, pNextRef, pBaseContainer);
+		Links->HasBaseContainer = false;
+		Data.Ref->DelRef(this, pPrevRef, pNextRef, pBaseContainer);
 		break;
 #ifdef C4ENGINE
-	case C4V_C4Object: Data.Obj->DelRef(this, pNextRef); break;
+	case C4V_C4Object: Data.Obj->DelRef(this, pPrevRef, pNextRef); break;
 	case C4V_Array: case C4V_Map: Data.Container->DecRef(); break;
 	case C4V_String: Data.Str->DecRef(); break;
 #endif
@@ -129,9 +131,8 @@ void C4Value::Set(C4V_Data nData, C4V_Type nType)
 
 	C4V_Data oData = Data;
 	C4V_Type oType = Type;
-	C4Value *oNextRef = NextRef;
-	auto *oBaseContainer = BaseContainer;
-	auto oHasBaseContainer = HasBaseContainer;
+	C4Value *oPrevRef = GetPrevRef(), *oNextRef = GetNextRef();
+	C4ValueContainer *oBaseContainer = GetBaseContainer();
 
 	// change
 	Data = nData;
@@ -143,7 +144,7 @@ void C4Value::Set(C4V_Data nData, C4V_Type nType)
 	AddDataRef();
 
 	// clean up
-	DelDataRef(oData, oType, oHasBaseContainer ? nullptr : oNextRef, oHasBaseContainer ? oBaseContainer : nullptr);
+	DelDataRef(oData, oType, oPrevRef, oNextRef, oBaseContainer);
 }
 
 void C4Value::Set0()
@@ -158,14 +159,14 @@ void C4Value::Set0()
 	CheckRemoveFromMap();
 
 	// clean up (save even if Data was 0 before)
-	DelDataRef(oData, oType, HasBaseContainer ? nullptr : NextRef, HasBaseContainer ? BaseContainer : nullptr);
+	DelDataRef(oData, oType, GetPrevRef(), GetNextRef(), GetBaseContainer());
 }
 
 void C4Value::CheckRemoveFromMap()
 {
-	if (Type == C4V_Any && OwningMap)
+	if (Type == C4V_Any && Links && Links->OwningMap)
 	{
-		OwningMap->removeValue(this);
+		Links->OwningMap->removeValue(this);
 	}
 }
 
@@ -174,15 +175,18 @@ void C4Value::Move(C4Value *nValue)
 	nValue->Set(*this);
 
 	// change references
-	for (C4Value *pVal = FirstRef; pVal; pVal = pVal->GetNextRef())
+	for (C4Value *pVal = GetFirstRef(); pVal; pVal = pVal->GetNextRef())
 		pVal->Data.Ref = nValue;
 
 	// copy ref list
-	assert(!nValue->FirstRef);
-	nValue->FirstRef = FirstRef;
+	assert(!nValue->GetFirstRef());
+	if (C4Value *pFirstRef = GetFirstRef())
+	{
+		nValue->GetLinks().FirstRef = pFirstRef;
+		Links->FirstRef = nullptr;
+	}
 
 	// delete usself
-	FirstRef = nullptr;
 	Set(0);
 }
 
@@ -220,15 +224,15 @@ void C4Value::GetContainerElement(C4Value *index, C4Value &target, C4AulContext
 		{
 			index->Deref();
 			// Is target the first ref?
-			if (!Ref.Data.Container->hasIndex(*index) || !(*Ref.Data.Container)[*index].FirstRef)
+			if (!Ref.Data.Container->hasIndex(*index) || !(*Ref.Data.Container)[*index].GetFirstRef())
 			{
 				Ref.Data.Container = Ref.Data.Container->IncElementRef();
 				target.SetRef(&(*Ref.Data.Container)[*index]);
 				if (target.Type == C4V_pC4Value)
 				{
-					assert(!target.NextRef);
-					target.BaseContainer = Ref.Data.Container;
-					target.HasBaseContainer = true;
+					assert(!target.GetNextRef());
+					target.Links->BaseContainer = Ref.Data.Container;
+					target.Links->HasBaseContainer = true;
 				}
 				// else target apparently owned the last reference to the array
 			}
@@ -273,33 +277,37 @@ C4Value &C4Value::GetRefVal()
 
 void C4Value::AddRef(C4Value *pRef)
 {
-	pRef->NextRef = FirstRef;
-	FirstRef = pRef;
+	C4ValueLinks &RefLinks = pRef->GetLinks(), &OwnLinks = GetLinks();
+	RefLinks.NextRef = OwnLinks.FirstRef;
+	RefLinks.PrevRef = nullptr;
+	if (OwnLinks.FirstRef) OwnLinks.FirstRef->Links->PrevRef = pRef;
+	OwnLinks.FirstRef = pRef;
 }
 
-void C4Value::DelRef(const C4Value *pRef, C4Value *pNextRef, C4ValueContainer *pBaseContainer)
+void C4Value::DelRef(const C4Value *pRef, C4Value *pPrevRef, C4Value *pNextRef, C4ValueContainer *pBaseContainer)
 {
-	if (pRef == FirstRef)
-		FirstRef = pNextRef;
+	// pRef may already be linked elsewhere, so its old neighbours are passed
+	if (!pPrevRef)
+	{
+		assert(pRef == Links->FirstRef);
+		Links->FirstRef = pNextRef;
+	}
 	else
 	{
-		C4Value *pVal = FirstRef;
-		while (pVal->NextRef != pRef)
-		{
-			// assert that pRef really was in the list
-			assert(pVal->NextRef && !pVal->HasBaseContainer);
-			pVal = pVal->NextRef;
-		}
-		pVal->NextRef = pNextRef;
+		C4ValueLinks &PrevLinks = *pPrevRef->Links;
+		assert(PrevLinks.NextRef == pRef && !PrevLinks.HasBaseContainer);
+		PrevLinks.NextRef = pNextRef;
+		// the last reference holds the base container
 		if (pBaseContainer)
 		{
-			pVal->HasBaseContainer = true;
-			pVal->BaseContainer = pBaseContainer;
+			PrevLinks.HasBaseContainer = true;
+			PrevLinks.BaseContainer = pBaseContainer;
 		}
 	}
+	if (pNextRef) pNextRef->Links->PrevRef = pPrevRef;
 	// Was pRef the last ref to an array element?
 #ifdef C4ENGINE
-	if (pBaseContainer && !FirstRef)
+	if (pBaseContainer && !Links->FirstRef)
 	{
 		pBaseContainer->DecElementRef();
 	}
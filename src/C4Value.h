@@ -82,47 +82,65 @@ struct C4VCnvFn
 
 template <typename T> struct C4ValueConv;
 
+// reference bookkeeping of a value
+// only allocated for values that reference an object or a value, are referenced themselves or belong to a map
+struct C4ValueLinks
+{
+	// reference-list (doubly linked, so references can be removed in constant time)
+	union
+	{
+		C4Value *NextRef = nullptr;
+		C4ValueContainer *BaseContainer;
+	};
+	C4Value *PrevRef = nullptr;
+	C4Value *FirstRef = nullptr;
+
+	C4ValueHash *OwningMap = nullptr;
+
+	bool HasBaseContainer = false;
+};
+
 class C4Value
 {
 public:
-	C4Value() : Type(C4V_Any), NextRef(nullptr), FirstRef(nullptr) { Data.Ref = 0; }
+	C4Value() : Type(C4V_Any) { Data.Ref = 0; }
 
-	C4Value(const C4Value &nValue) : Data(nValue.Data), Type(nValue.Type), NextRef(nullptr), FirstRef(nullptr)
+	C4Value(const C4Value &nValue) : Data(nValue.Data), Type(nValue.Type)
 	{
 		AddDataRef();
 	}
 
-	C4Value(C4V_Data nData, C4V_Type nType) : Data(nData), Type(nData || nType == C4V_Int || nType == C4V_Bool ? nType : C4V_Any), NextRef(nullptr), FirstRef(nullptr)
+	C4Value(C4V_Data nData, C4V_Type nType) : Data(nData), Type(nData || nType == C4V_Int || nType == C4V_Bool ? nType : C4V_Any)
 	{
 		AddDataRef();
 	}
 
-	C4Value(int32_t nData, C4V_Type nType) : Type(nData || nType == C4V_Int || nType == C4V_Bool ? nType : C4V_Any), NextRef(nullptr), FirstRef(nullptr)
+	C4Value(int32_t nData, C4V_Type nType) : Type(nData || nType == C4V_Int || nType == C4V_Bool ? nType : C4V_Any)
 	{
 		Data.Int = nData; AddDataRef();
 	}
 
-	explicit C4Value(C4Object *pObj) : Type(pObj ? C4V_C4Object : C4V_Any), NextRef(nullptr), FirstRef(nullptr)
+	explicit C4Value(C4Object *pObj) : Type(pObj ? C4V_C4Object : C4V_Any)
 	{
 		Data.Obj = pObj; AddDataRef();
 	}
 
-	explicit C4Value(C4String *pStr) : Type(pStr ? C4V_String : C4V_Any), NextRef(nullptr), FirstRef(nullptr)
+	explicit C4Value(C4String *pStr) : Type(pStr ? C4V_String : C4V_Any)
 	{
 		Data.Str = pStr; AddDataRef();
 	}
 
-	explicit C4Value(C4ValueArray *pArray) : Type(pArray ? C4V_Array : C4V_Any), NextRef(nullptr), FirstRef(nullptr)
+	explicit C4Value(C4ValueArray *pArray) : Type(pArray ? C4V_Array : C4V_Any)
 	{
 		Data.Array = pArray; AddDataRef();
 	}
 
-	explicit C4Value(C4ValueHash *pMap) : Type(pMap ? C4V_Map : C4V_Any), NextRef(nullptr), FirstRef(nullptr)
+	explicit C4Value(C4ValueHash *pMap) : Type(pMap ? C4V_Map : C4V_Any)
 	{
 		Data.Map = pMap; AddDataRef();
 	}
 
-	explicit C4Value(C4Value *pVal) : Type(pVal ? C4V_pC4Value : C4V_Any), NextRef(nullptr), FirstRef(nullptr)
+	explicit C4Value(C4Value *pVal) : Type(pVal ? C4V_pC4Value : C4V_Any)
 	{
 		Data.Ref = pVal; AddDataRef();
 	}
@@ -130,7 +148,7 @@ public:
 	static C4Value *OfMap(C4ValueHash *map)
 	{
 		auto ret = new C4Value;
-		ret->OwningMap = map;
+		ret->GetLinks().OwningMap = map;
 		return ret;
 	}
 
@@ -247,31 +265,26 @@ protected:
 	// data
 	C4V_Data Data;
 
-	// reference-list
-	union
-	{
-		C4Value *NextRef;
-		C4ValueContainer *BaseContainer;
-	};
-	C4Value *FirstRef;
-
-	C4ValueHash *OwningMap = nullptr;
+	// reference bookkeeping; kept out of line so plain values stay small
+	C4ValueLinks *Links = nullptr;
 
 	// data type
 	C4V_Type Type : 8;
-	bool HasBaseContainer = false;
 
-	C4Value *GetNextRef() { if (HasBaseContainer) return 0; else return NextRef; }
-	C4ValueContainer *GetBaseContainer() { if (HasBaseContainer) return BaseContainer; else return nullptr; }
+	C4ValueLinks &GetLinks() { if (!Links) Links = new C4ValueLinks; return *Links; }
+	C4Value *GetFirstRef() const { return Links ? Links->FirstRef : nullptr; }
+	C4Value *GetPrevRef() const { return Links ? Links->PrevRef : nullptr; }
+	C4Value *GetNextRef() const { if (!Links || Links->HasBaseContainer) return nullptr; else return Links->NextRef; }
+	C4ValueContainer *GetBaseContainer() const { if (Links && Links->HasBaseContainer) return Links->BaseContainer; else return nullptr; }
 
 	void Set(long nData, C4V_Type nType = C4V_Any) { C4V_Data d; d.Int = nData; Set(d, nType); }
 	void Set(C4V_Data nData, C4V_Type nType);
 
 	void AddRef(C4Value *pRef);
-	void DelRef(const C4Value *pRef, C4Value *pNextRef, C4ValueContainer *pBaseContainer);
+	void DelRef(const C4Value *pRef, C4Value *pPrevRef, C4Value *pNextRef, C4ValueContainer *pBaseContainer);
 
 	void AddDataRef();
-	void DelDataRef(C4V_Data Data, C4V_Type Type, C4Value *pNextRef, C4ValueContainer *pBaseContainer);
+	void DelDataRef(C4V_Data Data, C4V_Type Type, C4Value *pPrevRef, C4Value *pNextRef, C4ValueContainer *pBaseContainer);
 
 	void CheckRemoveFromMap();
 
@@ -28,7 +28,7 @@
 #include <C4Application.h>
 #include <C4ObjectCom.h>
 #include <C4FogOfWar.h>
-#include <C4Stat.h>
+#include <C4Profiler.h>
 #include <C4Gui.h>
 #include <C4Network2Dialogs.h>
 #include <C4GameDialogs.h>
@@ -818,33 +818,33 @@ void C4Viewport::DrawOverlay(C4FacetEx &cgo)
 	if (!Game.C4S.Head.Film || !Game.C4S.Head.Replay)
 	{
 		// Player info
-		C4ST_STARTNEW(CInfoStat, "C4Viewport::DrawOverlay: Cursor Info")
+		C4Profiler::Begin("C4Viewport::DrawOverlay: Cursor Info");
 		DrawCursorInfo(cgo);
-		C4ST_STOP(CInfoStat)
-		C4ST_STARTNEW(PInfoStat, "C4Viewport::DrawOverlay: Player Info")
+		C4Profiler::End();
+		C4Profiler::Begin("C4Viewport::DrawOverlay: Player Info");
 		DrawPlayerInfo(cgo);
-		C4ST_STOP(PInfoStat)
-		C4ST_STARTNEW(MenuStat, "C4Viewport::DrawOverlay: Menu")
+		C4Profiler::End();
+		C4Profiler::Begin("C4Viewport::DrawOverlay: Menu");
 		DrawMenu(cgo);
-		C4ST_STOP(MenuStat)
+		C4Profiler::End();
 	}
 	// Game messages
-	C4ST_STARTNEW(MsgStat, "C4Viewport::DrawOverlay: Messages")
+	C4Profiler::Begin("C4Viewport::DrawOverlay: Messages");
 	Game.Messages.Draw(cgo, Player);
-	C4ST_STOP(MsgStat)
+	C4Profiler::End();
 
 	// Control overlays (if not film/replay)
 	if (!Game.C4S.Head.Film || !Game.C4S.Head.Replay)
 		// Mouse control
 		if (Game.MouseControl.IsViewport(this))
 		{
-			C4ST_STARTNEW(MouseStat, "C4Viewport::DrawOverlay: Mouse")
+			C4Profiler::Begin("C4Viewport::DrawOverlay: Mouse");
 			if (Config.Graphics.ShowCommands) // Now, ShowCommands is respected even for mouse control...
 				DrawMouseButtons(cgo);
 			Game.MouseControl.Draw(cgo);
 			// Draw GUI-mouse in EM if active
 			if (pWindow && Game.pGUI) Game.pGUI->RenderMouse(cgo);
-			C4ST_STOP(MouseStat)
+			C4Profiler::End();
 		}
 	// Keyboard/Gamepad
 			else
@@ -876,15 +876,15 @@ void C4Viewport::DrawCursorInfo(C4FacetEx &cgo)
 	if (Config.Graphics.ShowPlayerHUDAlways)
 		if (cursor->Info)
 		{
-			C4ST_STARTNEW(ObjInfStat, "C4Viewport::DrawCursorInfo: Object info")
+			C4Profiler::Begin("C4Viewport::DrawCursorInfo: Object info");
 			ccgo.Set(cgo.Surface, cgo.X + C4SymbolBorder, cgo.Y + C4SymbolBorder, 3 * C4SymbolSize, C4SymbolSize);
 			cursor->Info->Draw(ccgo,
 				Config.Graphics.ShowPortraits,
 				(cursor == Game.Players.Get(Player)->Captain), cursor);
-			C4ST_STOP(ObjInfStat)
+			C4Profiler::End();
 		}
 
-	C4ST_STARTNEW(ContStat, "C4Viewport::DrawCursorInfo: Contents")
+	C4Profiler::Begin("C4Viewport::DrawCursorInfo: Contents");
 
 	// Draw contents
 	if (cursor->Contents.ObjectCount() == 1)
@@ -900,14 +900,14 @@ void C4Viewport::DrawCursorInfo(C4FacetEx &cgo)
 		cursor->Contents.DrawIDList(ccgo, -1, Game.Defs, C4D_All, SetRegions, COM_Contents, false);
 	}
 
-	C4ST_STOP(ContStat)
+	C4Profiler::End();
 
 	// Draw energy levels
 	if (cursor->ViewEnergy || Config.Graphics.ShowPlayerHUDAlways)
 		if (cgo.Hgt > 2 * C4SymbolSize + 2 * C4SymbolBorder)
 		{
 			int32_t cx = C4SymbolBorder;
-			C4ST_STARTNEW(EnStat, "C4Viewport::DrawCursorInfo: Energy")
+			C4Profiler::Begin("C4Viewport::DrawCursorInfo: Energy");
 			int32_t bar_wdt = Game.GraphicsResource.fctEnergyBars.Wdt;
 			int32_t iYOff = Config.Graphics.ShowPortraits ? 10 : 0;
 			// Energy
@@ -926,7 +926,7 @@ void C4Viewport::DrawCursorInfo(C4FacetEx &cgo)
 			{
 				cursor->DrawBreath(ccgo); ccgo.X += bar_wdt + 1;
 			}
-			C4ST_STOP(EnStat)
+			C4Profiler::End();
 		}
 
 	// Draw commands
@@ -934,7 +934,7 @@ void C4Viewport::DrawCursorInfo(C4FacetEx &cgo)
 		if (realcursor)
 			if (cgo.Hgt > C4SymbolSize)
 			{
-				C4ST_STARTNEW(CmdStat, "C4Viewport::DrawCursorInfo: Commands")
+				C4Profiler::Begin("C4Viewport::DrawCursorInfo: Commands");
 				int32_t iSize = 2 * C4SymbolSize / 3;
 				int32_t iSize2 = 2 * iSize;
 				// Primary area (bottom)
@@ -943,7 +943,7 @@ void C4Viewport::DrawCursorInfo(C4FacetEx &cgo)
 				ccgo2.Set(cgo.Surface, cgo.X + cgo.Wdt - iSize2, cgo.Y, iSize2, cgo.Hgt - iSize - 5);
 				// Draw commands
 				realcursor->DrawCommands(ccgo, ccgo2, SetRegions);
-				C4ST_STOP(CmdStat)
+				C4Profiler::End();
 			}
 }
 
@@ -1038,30 +1038,30 @@ void C4Viewport::Draw(C4FacetEx &cgo, bool fDrawOverlay)
 	else
 		lpDDraw->SetClrModMapEnabled(false);
 
-	C4ST_STARTNEW(SkyStat, "C4Viewport::Draw: Sky")
+	C4Profiler::Begin("C4Viewport::Draw: Sky");
 	Game.Landscape.Sky.Draw(cgo);
-	C4ST_STOP(SkyStat)
+	C4Profiler::End();
 	Game.BackObjects.DrawAll(cgo, Player);
 
 	// Draw Landscape
-	C4ST_STARTNEW(LandStat, "C4Viewport::Draw: Landscape")
+	C4Profiler::Begin("C4Viewport::Draw: Landscape");
 	Game.Landscape.Draw(cgo, Player);
-	C4ST_STOP(LandStat)
+	C4Profiler::End();
 
 	// draw PXS (unclipped!)
-	C4ST_STARTNEW(PXSStat, "C4Viewport::Draw: PXS")
+	C4Profiler::Begin("C4Viewport::Draw: PXS");
 	Game.PXS.Draw(cgo);
-	C4ST_STOP(PXSStat)
+	C4Profiler::End();
 
 	// draw objects
-	C4ST_STARTNEW(ObjStat, "C4Viewport::Draw: Objects")
+	C4Profiler::Begin("C4Viewport::Draw: Objects");
 	Game.Objects.Draw(cgo, Player);
-	C4ST_STOP(ObjStat)
+	C4Profiler::End();
 
 	// draw global particles
-	C4ST_STARTNEW(PartStat, "C4Viewport::Draw: Particles")
+	C4Profiler::Begin("C4Viewport::Draw: Particles");
 	Game.Particles.GlobalParticles.Draw(cgo, nullptr);
-	C4ST_STOP(PartStat)
+	C4Profiler::End();
 
 	// draw foreground objects
 	Game.ForeObjects.DrawIfCategory(cgo, Player, C4D_Parallax, true);
@@ -1087,7 +1087,7 @@ void C4Viewport::Draw(C4FacetEx &cgo, bool fDrawOverlay)
 	Game.ForeObjects.DrawIfCategory(cgo, Player, C4D_Parallax, false);
 
 	// Draw overlay
-	C4ST_STARTNEW(OvrStat, "C4Viewport::Draw: Overlay")
+	C4Profiler::Begin("C4Viewport::Draw: Overlay");
 
 	if (!Application.isFullScreen) Console.EditCursor.Draw(cgo);
 
@@ -1097,7 +1097,7 @@ void C4Viewport::Draw(C4FacetEx &cgo, bool fDrawOverlay)
 	if (Game.GraphicsSystem.ShowNetstatus)
 		Game.Network.DrawStatus(cgo);
 
-	C4ST_STOP(OvrStat)
+	C4Profiler::End();
 
 	// Remove clippers
 	if (fDrawOverlay) Application.DDraw->NoPrimaryClipper();
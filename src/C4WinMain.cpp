@@ -72,7 +72,7 @@ int WINAPI WinMain(HINSTANCE hInst,
 	Application.Clear();
 
 	// Return exit code
-	return C4XRV_Completed;
+	return Application.BenchmarkFailed ? C4XRV_Failure : C4XRV_Completed;
 }
 
 int main()
@@ -194,7 +194,7 @@ int main(int argc, char *argv[])
 	Application.Clear();
 	if (Application.restartAtEnd) restart(argv);
 	// Return exit code
-	return C4XRV_Completed;
+	return Application.BenchmarkFailed ? C4XRV_Failure : C4XRV_Completed;
 }
 
 #endif
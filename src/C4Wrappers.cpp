@@ -140,9 +140,5 @@ int32_t Hostile(int32_t plr1, int32_t plr2)
 
 void StdCompilerWarnCallback(void *pData, const char *szPosition, const char *szError)
 {
-	const char *szName = reinterpret_cast<const char *>(pData);
-	if (!szPosition || !*szPosition)
-		DebugLogF("WARNING: %s (in %s)", szError, szName);
-	else
-		DebugLogF("WARNING: %s (in %s, %s)", szError, szPosition, szName);
+	DebugLog(StdCompilerWarnMessage(reinterpret_cast<const char *>(pData), szPosition, szError).getData());
 }
@@ -183,17 +183,18 @@ inline int32_t GBackDensity(int32_t x, int32_t y)
 
 inline bool GBackSolid(int32_t x, int32_t y)
 {
-	return DensitySolid(GBackDensity(x, y));
+	return Game.Landscape.InPlanes(C4LS_PlaneSolid, x, y);
 }
 
 inline bool GBackSemiSolid(int32_t x, int32_t y)
 {
-	return DensitySemiSolid(GBackDensity(x, y));
+	// semi solid densities are exactly the liquid and solid ones
+	return Game.Landscape.InPlanes(C4LS_PlaneSolid | C4LS_PlaneLiquid, x, y);
 }
 
 inline bool GBackLiquid(int32_t x, int32_t y)
 {
-	return DensityLiquid(GBackDensity(x, y));
+	return Game.Landscape.InPlanes(C4LS_PlaneLiquid, x, y);
 }
 
 inline int32_t GBackWind(int32_t x, int32_t y)
@@ -218,10 +219,26 @@ bool CompileFromBuf_LogWarn(StructT &&TargetStruct, const typename CompT::InT &S
 	}
 	catch (StdCompiler::Exception *pExc)
 	{
-		if (!pExc->Pos.getLength())
-			LogF("ERROR: %s (in %s)", pExc->Msg.getData(), szName);
-		else
-			LogF("ERROR: %s (in %s, %s)", pExc->Msg.getData(), pExc->Pos.getData(), szName);
+		Log(StdCompilerErrorMessage(szName, *pExc).getData());
+		delete pExc;
+		return false;
+	}
+}
+
+template <class CompT, class StructT>
+bool CompileFromBuf_CollectWarn(StructT &&TargetStruct, const typename CompT::InT &SrcBuf, StdCompilerMessages &Messages)
+{
+	try
+	{
+		CompT Compiler;
+		Compiler.setInput(SrcBuf);
+		Compiler.setWarnCallback(&StdCompilerMessages::WarnCallback, &Messages);
+		Compiler.Compile(TargetStruct);
+		return true;
+	}
+	catch (StdCompiler::Exception *pExc)
+	{
+		Messages.Error = StdCompilerErrorMessage(Messages.Name.c_str(), *pExc).getData();
 		delete pExc;
 		return false;
 	}
@@ -27,12 +27,23 @@
 #include <fcntl.h>
 #include <assert.h>
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include <algorithm>
+#include <cstring>
 
 CStdFile::CStdFile()
 {
 	Status = false;
 	hFile = nullptr;
+	MappedData = nullptr;
+	MappedSize = MappedStart = MappedPtr = 0;
+	MappedFile = false;
 	ClearBuffer();
 	ModeWrite = false;
 	Name[0] = 0;
@@ -116,6 +127,60 @@ bool CStdFile::Open(const char *szFilename, bool fCompressed)
 	return true;
 }
 
+bool CStdFile::OpenMapped(const char *szFilename, size_t iStart)
+{
+	SCopy(szFilename, Name, _MAX_PATH);
+	// Set modes
+	ModeWrite = false;
+	// Map whole file
+	const size_t iSize = FileSize(szFilename);
+	if (iSize < iStart || !iSize) return false;
+#ifdef _WIN32
+	HANDLE hMapFile = CreateFileA(szFilename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hMapFile == INVALID_HANDLE_VALUE) return false;
+	HANDLE hMapping = CreateFileMappingA(hMapFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(hMapFile);
+	if (!hMapping) return false;
+	// the view keeps the mapping alive
+	void *pData = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(hMapping);
+	if (!pData) return false;
+#else
+	const int fd = open(szFilename, O_RDONLY);
+	if (fd == -1) return false;
+	void *pData = mmap(nullptr, iSize, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (pData == MAP_FAILED) return false;
+#endif
+	MappedData = static_cast<uint8_t *>(pData);
+	MappedSize = iSize;
+	MappedStart = MappedPtr = iStart;
+	MappedFile = true;
+	// Reset buffer
+	ClearBuffer();
+	// Set status
+	Status = true;
+	return true;
+}
+
+bool CStdFile::OpenMemory(const char *szName, const void *pData, size_t iSize)
+{
+	SCopy(szName, Name, _MAX_PATH);
+	// Set modes
+	ModeWrite = false;
+	if (!pData || !iSize) return false;
+	// Read from buffer like from a mapped file
+	MappedData = static_cast<uint8_t *>(const_cast<void *>(pData));
+	MappedSize = iSize;
+	MappedStart = MappedPtr = 0;
+	MappedFile = false;
+	// Reset buffer
+	ClearBuffer();
+	// Set status
+	Status = true;
+	return true;
+}
+
 bool CStdFile::Append(const char *szFilename)
 {
 	SCopy(szFilename, Name, _MAX_PATH);
@@ -143,6 +208,18 @@ bool CStdFile::Close()
 	writeCompressedFile.reset();
 	if (hFile) if (fclose(hFile) != 0) rval = false;
 	hFile = nullptr;
+	if (MappedData)
+	{
+		if (MappedFile)
+		{
+#ifdef _WIN32
+			UnmapViewOfFile(MappedData);
+#else
+			munmap(MappedData, MappedSize);
+#endif
+		}
+		MappedData = nullptr;
+	}
 	return !!rval;
 }
 
@@ -153,6 +230,7 @@ bool CStdFile::Default()
 	readCompressedFile.reset();
 	writeCompressedFile.reset();
 	hFile = nullptr;
+	MappedData = nullptr;
 	BufferLoad = BufferPtr = 0;
 	return true;
 }
@@ -164,6 +242,15 @@ bool CStdFile::Read(void *pBuffer, size_t iSize, size_t *ipFSize)
 	if (ModeWrite) return false;
 	uint8_t *bypBuffer = (uint8_t *)pBuffer;
 	if (ipFSize) *ipFSize = 0;
+	// Mapped file: Just copy
+	if (MappedData)
+	{
+		const size_t transfer = std::min(MappedSize - MappedPtr, iSize);
+		memcpy(bypBuffer, MappedData + MappedPtr, transfer);
+		MappedPtr += transfer;
+		if (ipFSize) *ipFSize = transfer;
+		return transfer == iSize;
+	}
 	while (iSize > 0)
 	{
 		// Valid data in the buffer: Transfer as much as possible
@@ -263,6 +350,7 @@ bool CStdFile::Rewind()
 {
 	if (ModeWrite) return false;
 	ClearBuffer();
+	MappedPtr = MappedStart;
 	if (hFile) rewind(hFile);
 	if (readCompressedFile)
 	{
@@ -271,9 +359,48 @@ bool CStdFile::Rewind()
 	return true;
 }
 
+bool CStdFile::Seek(size_t iOffset)
+{
+	if (ModeWrite) return false;
+	if (MappedData)
+	{
+		if (iOffset > MappedSize - MappedStart) return false;
+		MappedPtr = MappedStart + iOffset;
+		return true;
+	}
+	if (readCompressedFile)
+	{
+		// Target still in buffer: Just move there
+		const size_t iBufferEnd = readCompressedFile->Position(), iBufferStart = iBufferEnd - BufferLoad;
+		if (iOffset >= iBufferStart && iOffset <= iBufferEnd)
+		{
+			BufferPtr = iOffset - iBufferStart;
+			return true;
+		}
+		ClearBuffer();
+		try
+		{
+			readCompressedFile->Seek(iOffset);
+		}
+		catch (const StdGzCompressedFile::Exception &)
+		{
+			return false;
+		}
+		return readCompressedFile->Position() == iOffset;
+	}
+	ClearBuffer();
+	return hFile && !fseek(hFile, iOffset, SEEK_SET);
+}
+
 bool CStdFile::Advance(int iOffset)
 {
 	if (ModeWrite) return false;
+	if (MappedData)
+	{
+		if (iOffset > 0 && static_cast<size_t>(iOffset) > MappedSize - MappedPtr) return false;
+		MappedPtr += iOffset;
+		return true;
+	}
 	while (iOffset > 0)
 	{
 		// Valid data in the buffer: Transfer as much as possible
@@ -341,6 +468,7 @@ int CStdFile::AccessedEntrySize()
 		fseek(hFile, pos, SEEK_SET);
 		return r;
 	}
+	if (MappedData) return static_cast<int>(MappedSize - MappedStart);
 	assert(!readCompressedFile);
 	return 0;
 }
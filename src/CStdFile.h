@@ -51,10 +51,15 @@ protected:
 	uint8_t Buffer[CStdFileBufSize];
 	int BufferLoad, BufferPtr;
 	bool ModeWrite;
+	uint8_t *MappedData; // read-only memory mapping of the whole file; used instead of hFile and Buffer
+	size_t MappedSize, MappedStart, MappedPtr;
+	bool MappedFile; // whether MappedData is a file mapping owned by this object or just refers to a memory buffer
 
 public:
 	bool Create(const char *szFileName, bool fCompressed = false, bool fExecutable = false);
 	bool Open(const char *szFileName, bool fCompressed = false);
+	bool OpenMapped(const char *szFileName, size_t iStart = 0); // map uncompressed file; reading starts at iStart
+	bool OpenMemory(const char *szName, const void *pData, size_t iSize); // read from buffer, which must outlive the file
 	bool Append(const char *szFilename); // append (uncompressed only)
 	bool Close();
 	bool Default();
@@ -64,6 +69,7 @@ public:
 	bool WriteString(const char *szStr);
 	bool Rewind();
 	bool Advance(int iOffset);
+	bool Seek(size_t iOffset); // read position from file start
 	// Single line commands
 	bool Load(const char *szFileName, uint8_t **lpbpBuf,
 		int *ipSize = nullptr, int iAppendZeros = 0,
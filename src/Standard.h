@@ -125,6 +125,30 @@ inline int DWordAligned(int val)
 	return val;
 }
 
+// number of set bits
+inline int BitCount64(uint64_t val)
+{
+#ifdef __GNUC__
+	return __builtin_popcountll(val);
+#else
+	int iCount = 0;
+	for (; val; val &= val - 1) ++iCount;
+	return iCount;
+#endif
+}
+
+// index of the lowest set bit; val must not be zero
+inline int LowestBit64(uint64_t val)
+{
+#ifdef __GNUC__
+	return __builtin_ctzll(val);
+#else
+	int iBit = 0;
+	for (; !(val & 1); val >>= 1) ++iBit;
+	return iBit;
+#endif
+}
+
 inline int32_t ForceLimits(int32_t &rVal, int32_t iLow, int32_t iHi)
 {
 	if (rVal < iLow) { rVal = iLow; return -1; }
@@ -19,6 +19,7 @@
 #include <cerrno>
 #include <cstring>
 #include <memory>
+#include <thread>
 
 namespace StdGzCompressedFile
 {
@@ -179,12 +180,15 @@ size_t Read::ReadData(uint8_t *const toBuffer, const size_t size)
 		const auto oldAvailIn = gzStream.avail_in;
 		const auto oldAvailOut = gzStream.avail_out;
 
-		if (const auto ret = inflate(&gzStream, Z_SYNC_FLUSH); ret != Z_OK)
+		// stop at block boundaries so checkpoints can be taken
+		bool streamEnd = false;
+		if (const auto ret = inflate(&gzStream, Z_BLOCK); ret != Z_OK)
 		{
 			if (ret == Z_STREAM_END)
 			{
 				inflateEnd(&gzStream);
 				gzStreamValid = false;
+				streamEnd = true;
 			}
 			else if (ret != Z_BUF_ERROR && gzStream.avail_out != 0)
 			{
@@ -194,10 +198,26 @@ size_t Read::ReadData(uint8_t *const toBuffer, const size_t size)
 		const auto outProgress = oldAvailOut - gzStream.avail_out;
 		position += outProgress;
 		readSize += outProgress;
+		InflatedBytes += outProgress;
 
 		const auto inProgress = oldAvailIn - gzStream.avail_in;
 		bufferPtr += inProgress;
 		bufferedSize -= inProgress;
+
+		if (streamEnd && rawStream)
+		{
+			// skip the gzip trailer (CRC32 and size) zlib did not read
+			SkipInput(8);
+			gzStream.next_in = bufferPtr;
+			gzStream.avail_in = bufferedSize;
+			rawStream = false;
+		}
+		// at a block boundary that is not the end of the stream?
+		else if (gzStreamValid && (gzStream.data_type & 128) && !(gzStream.data_type & 64) &&
+			position >= (checkpoints.empty() ? 0 : checkpoints.back().position) + CheckpointDistance)
+		{
+			AddCheckpoint();
+		}
 	}
 
 	return readSize;
@@ -208,11 +228,92 @@ void Read::RefillBuffer()
 	bufferedSize = fread(buffer.get(), 1, ChunkSize, file);
 	if (ferror(file)) throw Exception("fread failed");
 	bufferPtr = buffer.get();
+	filePosition += bufferedSize;
+}
+
+void Read::SkipInput(size_t size)
+{
+	while (size > 0)
+	{
+		if (bufferedSize == 0)
+		{
+			RefillBuffer();
+			if (bufferedSize == 0) throw Exception("Unexpected end of file");
+		}
+
+		const auto progress = std::min(size, bufferedSize);
+		bufferPtr += progress;
+		bufferedSize -= progress;
+		size -= progress;
+	}
+}
+
+void Read::AddCheckpoint()
+{
+	Checkpoint checkpoint;
+	checkpoint.position = position;
+	checkpoint.filePosition = filePosition - bufferedSize;
+	checkpoint.bits = gzStream.data_type & 7;
+	checkpoint.window.resize(32768);
+
+	uInt windowSize = 0;
+	if (inflateGetDictionary(&gzStream, checkpoint.window.data(), &windowSize) != Z_OK) return;
+	checkpoint.window.resize(windowSize);
+
+	checkpoints.push_back(std::move(checkpoint));
+}
+
+void Read::RestoreCheckpoint(const Checkpoint &checkpoint)
+{
+	if (gzStreamValid)
+	{
+		inflateEnd(&gzStream);
+		gzStreamValid = false;
+	}
+
+	// start reading at the byte containing the first bits of the block
+	filePosition = checkpoint.filePosition - (checkpoint.bits ? 1 : 0);
+	if (fseek(file, static_cast<long>(filePosition), SEEK_SET) != 0) throw Exception("fseek failed");
+	bufferPtr = buffer.get();
+	bufferedSize = 0;
+
+	gzStream.zalloc = nullptr;
+	gzStream.zfree = nullptr;
+	gzStream.opaque = nullptr;
+	gzStream.next_in = nullptr;
+	gzStream.avail_in = 0;
+
+	if (const auto ret = inflateInit2(&gzStream, -15); ret != Z_OK) // raw deflate
+	{
+		throw Exception(std::string{"inflateInit2 failed: "} + zError(ret));
+	}
+	gzStreamValid = true;
+	rawStream = true;
+
+	if (checkpoint.bits)
+	{
+		RefillBuffer();
+		if (bufferedSize == 0) throw Exception("Unexpected end of file");
+		inflatePrime(&gzStream, checkpoint.bits, *bufferPtr >> (8 - checkpoint.bits));
+		++bufferPtr;
+		--bufferedSize;
+	}
+
+	if (const auto ret = inflateSetDictionary(&gzStream, checkpoint.window.data(), static_cast<uInt>(checkpoint.window.size())); ret != Z_OK)
+	{
+		throw Exception(std::string{"inflateSetDictionary failed: "} + zError(ret));
+	}
+
+	gzStream.next_in = bufferPtr;
+	gzStream.avail_in = bufferedSize;
+	position = checkpoint.position;
 }
 
 void Read::Rewind()
 {
 	position = 0;
+	filePosition = 0;
+	rawStream = false;
 	fseek(file, 0, SEEK_SET);
 
 	inflateEnd(&gzStream);
@@ -223,7 +324,33 @@ void Read::Rewind()
 	PrepareInflate();
 }
 
-Write::Write(const std::string &filename)
+void Read::Seek(const size_t offset)
+{
+	// last checkpoint at or before offset
+	const auto it = std::upper_bound(checkpoints.begin(), checkpoints.end(), offset,
+		[](const size_t offset, const Checkpoint &checkpoint) { return offset < checkpoint.position; });
+
+	// continue from the current position if there is no closer checkpoint
+	if (offset < position || (it != checkpoints.begin() && std::prev(it)->position > position))
+	{
+		if (it == checkpoints.begin())
+		{
+			Rewind();
+		}
+		else
+		{
+			RestoreCheckpoint(*std::prev(it));
+		}
+	}
+
+	uint8_t skipBuffer[16384];
+	while (position < offset)
+	{
+		if (ReadData(skipBuffer, std::min(offset - position, sizeof(skipBuffer))) == 0) break;
+	}
+}
+
+Write::Write(const std::string &filename) : threadCount{std::max(ThreadCount, 1)}
 {
 	file = fopen(filename.c_str(), "wb");
 	if (!file)
@@ -231,6 +358,23 @@ Write::Write(const std::string &filename)
 		throw Exception(std::string{"Opening \""} + filename + "\": " + std::strerror(errno));
 	}
 
+	if (threadCount > 1)
+	{
+		// gzip header as deflateInit2 writes it for level 9, starting with the C4Group magic
+		const uint8_t header[10] = {C4GroupMagic[0], C4GroupMagic[1], Z_DEFLATED, 0, 0, 0, 0, 0, 2, 3};
+		try
+		{
+			WriteToFile(header, sizeof(header));
+		}
+		catch (...)
+		{
+			fclose(file);
+			throw;
+		}
+		crc = crc32(0, nullptr, 0);
+		return;
+	}
+
 	gzStream.zalloc = nullptr;
 	gzStream.zfree = nullptr;
 	gzStream.opaque = nullptr;
@@ -248,6 +392,25 @@ Write::Write(const std::string &filename)
 
 Write::~Write() noexcept(false)
 {
+	if (threadCount > 1)
+	{
+		if (file)
+		{
+			DeflateBlocks(true);
+
+			// gzip trailer: CRC32 and size, little endian
+			uint8_t trailer[8];
+			for (int i = 0; i < 4; ++i)
+			{
+				trailer[i] = static_cast<uint8_t>(crc >> (8 * i));
+				trailer[4 + i] = static_cast<uint8_t>(totalSize >> (8 * i));
+			}
+			WriteToFile(trailer, sizeof(trailer));
+			fclose(file);
+		}
+		return;
+	}
+
 	if (file)
 	{
 		DeflateToBuffer(nullptr, 0, Z_FINISH, Z_STREAM_END);
@@ -259,6 +422,109 @@ Write::~Write() noexcept(false)
 	deflateEnd(&gzStream);
 }
 
+void Write::WriteToFile(const uint8_t *const data, const size_t size)
+{
+	if (fwrite(data, 1, size, file) != size)
+	{
+		throw Exception("fwrite failed");
+	}
+}
+
+void Write::DeflateBlocks(const bool finish)
+{
+	const size_t pendingSize = input.size() - dictionaryLength;
+	// only complete blocks, unless the last one is needed to end the stream
+	size_t blockCount = pendingSize / ParallelBlockSize;
+	if (finish && (pendingSize % ParallelBlockSize != 0 || blockCount == 0)) ++blockCount;
+	if (blockCount == 0) return;
+
+	std::vector<std::vector<uint8_t>> outputs(blockCount);
+	std::atomic<size_t> nextBlock{0};
+	std::atomic<bool> failed{false};
+	const auto deflateBlocks = [&]
+	{
+		for (size_t i; (i = nextBlock.fetch_add(1)) < blockCount; )
+		{
+			const size_t start = dictionaryLength + i * ParallelBlockSize;
+			const size_t dictionarySize = std::min<size_t>(start, DictionarySize);
+			try
+			{
+				outputs[i] = DeflateBlock(input.data() + start - dictionarySize, dictionarySize,
+					input.data() + start, std::min<size_t>(ParallelBlockSize, input.size() - start), finish && i == blockCount - 1);
+			}
+			catch (const Exception &)
+			{
+				failed = true;
+			}
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (size_t i = 1; i < std::min<size_t>(threadCount, blockCount); ++i)
+	{
+		threads.emplace_back(deflateBlocks);
+	}
+	deflateBlocks();
+	for (auto &thread : threads)
+	{
+		thread.join();
+	}
+	if (failed) throw Exception("Deflating the data to write in parallel failed");
+
+	for (const auto &output : outputs)
+	{
+		WriteToFile(output.data(), output.size());
+	}
+
+	// keep the end of the deflated input as dictionary of the next block
+	const size_t deflatedEnd = std::min(input.size(), dictionaryLength + blockCount * ParallelBlockSize);
+	const size_t newDictionaryLength = std::min<size_t>(deflatedEnd, DictionarySize);
+	input.erase(input.begin(), input.begin() + (deflatedEnd - newDictionaryLength));
+	dictionaryLength = newDictionaryLength;
+}
+
+std::vector<uint8_t> Write::DeflateBlock(const uint8_t *const dictionary, const size_t dictionarySize, const uint8_t *const data, const size_t size, const bool last)
+{
+	z_stream stream;
+	stream.zalloc = nullptr;
+	stream.zfree = nullptr;
+	stream.opaque = nullptr;
+
+	if (const auto ret = deflateInit2(&stream, 9, Z_DEFLATED, -15, 9, Z_DEFAULT_STRATEGY); ret != Z_OK) // raw deflate
+	{
+		throw Exception(std::string{"deflateInit2 failed: "} + zError(ret));
+	}
+
+	std::vector<uint8_t> output(deflateBound(&stream, size) + 16);
+	int ret = Z_OK;
+	if (dictionarySize > 0)
+	{
+		ret = deflateSetDictionary(&stream, dictionary, static_cast<uInt>(dictionarySize));
+	}
+
+	stream.next_in = data;
+	stream.avail_in = static_cast<uInt>(size);
+	stream.next_out = output.data();
+	stream.avail_out = static_cast<uInt>(output.size());
+
+	// the sync flush ends the block on a byte boundary
+	while (ret == Z_OK && (ret = deflate(&stream, last ? Z_FINISH : Z_SYNC_FLUSH)) == Z_OK && stream.avail_out == 0)
+	{
+		const size_t used = output.size();
+		output.resize(2 * used);
+		stream.next_out = output.data() + used;
+		stream.avail_out = static_cast<uInt>(used);
+	}
+	output.resize(output.size() - stream.avail_out);
+	deflateEnd(&stream);
+
+	if (ret != (last ? Z_STREAM_END : Z_OK))
+	{
+		throw Exception(std::string{"Deflating a block: "} + zError(ret));
+	}
+	return output;
+}
+
 void Write::FlushBuffer()
 {
 	if (fwrite(buffer.get(), 1, bufferedSize, file) != bufferedSize)
@@ -323,6 +589,18 @@ void Write::DeflateToBuffer(const uint8_t *const fromBuffer, const size_t size,
 
 void Write::WriteData(const uint8_t *const fromBuffer, const size_t size)
 {
+	if (threadCount > 1)
+	{
+		crc = crc32(crc, fromBuffer, static_cast<uInt>(size));
+		totalSize += size;
+		input.insert(input.end(), fromBuffer, fromBuffer + size);
+		if (input.size() - dictionaryLength >= static_cast<size_t>(threadCount) * ParallelBlockSize)
+		{
+			DeflateBlocks(false);
+		}
+		return;
+	}
+
 	DeflateToBuffer(fromBuffer, size, Z_NO_FLUSH, Z_OK);
 }
 };
@@ -16,11 +16,13 @@
 // wraps zlib's inflate for reading and deflate for writing gzip compressed group files with C4Group magic bytes
 
 #pragma once
+#include <atomic>
 #include <cstdio>
 #include <cstdint>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #define ZLIB_CONST
 #include <zlib.h>
@@ -32,29 +34,51 @@ using Exception = std::runtime_error;
 static constexpr uint8_t C4GroupMagic[2] = {0x1e, 0x8c};
 static constexpr uint8_t GZMagic[2] = {0x1f, 0x8b};
 static constexpr auto ChunkSize = 1024 * 1024;
+static constexpr auto CheckpointDistance = 1024 * 1024; // uncompressed bytes between seek checkpoints
+static constexpr auto ParallelBlockSize = 256 * 1024; // uncompressed bytes deflated independently when writing in parallel
+static constexpr auto DictionarySize = 32 * 1024;
 
 class Read
 {
+	// inflate state at a deflate block boundary, from where reading can be resumed
+	struct Checkpoint
+	{
+		size_t position; // uncompressed
+		size_t filePosition; // of the first compressed byte after the boundary
+		int bits; // bits of the preceding byte that belong to the next block
+		std::vector<uint8_t> window; // last inflated bytes
+	};
+
 	std::unique_ptr<uint8_t[]> buffer{new uint8_t[ChunkSize]};
 	uint8_t *bufferPtr = nullptr;
 	size_t bufferedSize = 0;
 
 	FILE *file;
+	size_t filePosition = 0;
 	size_t position = 0;
 	z_stream gzStream;
 	bool gzStreamValid = false;
+	bool rawStream = false; // resumed from a checkpoint: no gzip header and trailer handling by zlib
+	std::vector<Checkpoint> checkpoints; // built while reading, ascending by position
 
 public:
+	static inline std::atomic<size_t> InflatedBytes{0}; // by all readers, including skipped data
+
 	Read(const std::string &filename);
 	~Read();
 	size_t UncompressedSize();
 	size_t ReadData(uint8_t *toBuffer, size_t size);
+	size_t Position() const { return position; }
 	void Rewind();
+	void Seek(size_t offset); // uncompressed offset; resumes from the nearest checkpoint if needed
 
 private:
 	void CheckMagicBytes();
 	void PrepareInflate();
 	void RefillBuffer();
+	void SkipInput(size_t size);
+	void AddCheckpoint();
+	void RestoreCheckpoint(const Checkpoint &checkpoint);
 };
 
 class Write
@@ -65,7 +89,17 @@ class Write
 	size_t bufferedSize = 0;
 	bool magicBytesDone = false;
 
+	// parallel mode: blocks are deflated on several threads, each primed with the preceding input as dictionary
+	// and flushed to a byte boundary, so the results can be joined to one gzip stream
+	const int threadCount;
+	std::vector<uint8_t> input; // dictionary of the next block followed by all input not deflated yet
+	size_t dictionaryLength = 0;
+	uLong crc = 0;
+	size_t totalSize = 0;
+
 public:
+	static inline int ThreadCount = 1; // for new files; more than one enables parallel mode
+
 	Write(const std::string &filename);
 	~Write() noexcept(false);
 	void WriteData(const uint8_t *const fromBuffer, const size_t size);
@@ -73,5 +107,8 @@ public:
 private:
 	void FlushBuffer();
 	void DeflateToBuffer(const uint8_t *const fromBuffer, const size_t size, int flushMode, int expectedRet);
+	void WriteToFile(const uint8_t *const data, const size_t size);
+	void DeflateBlocks(bool finish);
+	static std::vector<uint8_t> DeflateBlock(const uint8_t *dictionary, size_t dictionarySize, const uint8_t *data, size_t size, bool last);
 };
 };
@@ -704,6 +704,7 @@ bool CSurface::BltPix(int iX, int iY, CSurface *sfcSource, int iSrcX, int iSrcY,
 	if (!GetLockTexAt(&pTexRef, iX, iY)) return false;
 
 	uint32_t *pPix = (uint32_t *)(((uint8_t *)pTexRef->texLock.pBits) + iY * pTexRef->texLock.Pitch + iX * 4);
+	pTexRef->MarkDirty(iX, iY);
 	// get source pix as dword
 	uint32_t srcPix = sfcSource->GetPixDw(iSrcX, iSrcY, true);
 	// merge
@@ -793,6 +794,7 @@ bool CSurface::CopyBytes(uint8_t *pImageData)
 				pSource += iSrcPitch;
 				pTarget += pTex->iSize * 4;
 			}
+			pTex->MarkDirty({0, 0, iCpyNum / 4, iYMax});
 			pSource += iCpyNum - iSrcPitch * iYMax;
 			iXImgPos += pTex->iSize;
 		}
@@ -808,6 +810,7 @@ CTexRef::CTexRef(int iSize, bool fSingle)
 	texName = 0;
 #endif
 	texLock.pBits = nullptr; fIntLock = false;
+	ClearDirty();
 	// store size
 	this->iSize = iSize;
 	// add to texture manager
@@ -883,6 +886,9 @@ bool CTexRef::LockForUpdate(RECT &rtUpdate)
 				(rtUpdate.right - rtUpdate.left) * (rtUpdate.bottom - rtUpdate.top) * 4];
 			texLock.Pitch = (rtUpdate.right - rtUpdate.left) * 4;
 			LockSize = rtUpdate;
+			// the previous content is discarded, so all of it has to be uploaded
+			ClearDirty();
+			MarkAllDirty();
 			return true;
 		}
 	}
@@ -901,6 +907,7 @@ bool CTexRef::Lock()
 	if (texLock.pBits) return true;
 	LockSize.right = LockSize.bottom = iSize;
 	LockSize.top = LockSize.left = 0;
+	ClearDirty();
 	// lock
 #ifndef USE_CONSOLE
 	if (pGL)
@@ -947,14 +954,22 @@ void CTexRef::Unlock()
 			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
 			glTexImage2D(GL_TEXTURE_2D, 0, 4, iSize, iSize, 0, GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, texLock.pBits);
+			pTexMgr->iUploadedBytes += iSize * iSize * 4; ++pTexMgr->iUploadCount;
 		}
-		else
+		else if (IsDirty())
 		{
-			// reuse the existing texture
+			// reuse the existing texture and only upload what has been changed
+			const int iWdt = Dirty.right - Dirty.left, iHgt = Dirty.bottom - Dirty.top;
 			glBindTexture(GL_TEXTURE_2D, texName);
-			glTexSubImage2D(GL_TEXTURE_2D, 0,
-				LockSize.left, LockSize.top, LockSize.right - LockSize.left, LockSize.bottom - LockSize.top,
+			glPixelStorei(GL_UNPACK_ROW_LENGTH, texLock.Pitch / 4);
+			glPixelStorei(GL_UNPACK_SKIP_PIXELS, Dirty.left - LockSize.left);
+			glPixelStorei(GL_UNPACK_SKIP_ROWS, Dirty.top - LockSize.top);
+			glTexSubImage2D(GL_TEXTURE_2D, 0, Dirty.left, Dirty.top, iWdt, iHgt,
 				GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, texLock.pBits);
+			glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+			glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+			glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+			pTexMgr->iUploadedBytes += iWdt * iHgt * 4; ++pTexMgr->iUploadCount;
 		}
 		delete[] texLock.pBits; texLock.pBits = nullptr;
 		// switch back to original context
@@ -964,6 +979,22 @@ void CTexRef::Unlock()
 	{
 		// nothing to do
 	}
+	ClearDirty();
+}
+
+void CTexRef::MarkDirty(const RECT &rtDirty)
+{
+	// clip to the locked area
+	const auto iLeft = (std::max)(rtDirty.left, LockSize.left), iTop = (std::max)(rtDirty.top, LockSize.top);
+	const auto iRight = (std::min)(rtDirty.right, LockSize.right), iBottom = (std::min)(rtDirty.bottom, LockSize.bottom);
+	if (iRight <= iLeft || iBottom <= iTop) return;
+	if (!IsDirty())
+	{
+		Dirty.left = iLeft; Dirty.top = iTop; Dirty.right = iRight; Dirty.bottom = iBottom;
+		return;
+	}
+	Dirty.left = (std::min)(Dirty.left, iLeft); Dirty.top = (std::min)(Dirty.top, iTop);
+	Dirty.right = (std::max)(Dirty.right, iRight); Dirty.bottom = (std::max)(Dirty.bottom, iBottom);
 }
 
 bool CTexRef::ClearRect(RECT &rtClear)
@@ -986,6 +1017,7 @@ bool CTexRef::FillBlack()
 	if (!Lock()) return false;
 	// clear pixels
 	std::fill_n(reinterpret_cast<std::uint32_t *>(texLock.pBits), iSize * iSize, 0);
+	MarkAllDirty();
 	// success
 	return true;
 }
@@ -996,6 +1028,7 @@ CTexMgr::CTexMgr()
 {
 	// clear textures
 	Textures.clear();
+	ResetUploadStats();
 }
 
 CTexMgr::~CTexMgr()
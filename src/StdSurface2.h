@@ -212,6 +212,7 @@ public:
 	int iSize;
 	bool fIntLock; // if set, texref is locked internally only
 	RECT LockSize;
+	RECT Dirty; // part of the locked area that has been modified and must be uploaded on Unlock; empty if right <= left
 
 	CTexRef(int iSize, bool fAsRenderTarget); // create texture with given size
 	~CTexRef(); // release texture
@@ -226,7 +227,24 @@ public:
 	void SetPix(int iX, int iY, uint32_t v)
 	{
 		*((uint32_t *)(((uint8_t *)texLock.pBits) + (iY - LockSize.top) * texLock.Pitch + (iX - LockSize.left) * 4)) = v;
+		MarkDirty(iX, iY);
 	}
+
+	// extend the dirty area; callers writing to texLock.pBits directly must mark what they changed
+	void MarkDirty(int iX, int iY)
+	{
+		if (Dirty.right <= Dirty.left)
+		{
+			Dirty.left = iX; Dirty.top = iY; Dirty.right = iX + 1; Dirty.bottom = iY + 1;
+			return;
+		}
+		if (iX < Dirty.left) Dirty.left = iX; else if (iX >= Dirty.right) Dirty.right = iX + 1;
+		if (iY < Dirty.top) Dirty.top = iY; else if (iY >= Dirty.bottom) Dirty.bottom = iY + 1;
+	}
+	void MarkDirty(const RECT &rtDirty);
+	void MarkAllDirty() { MarkDirty(LockSize); }
+	bool IsDirty() const { return Dirty.right > Dirty.left && Dirty.bottom > Dirty.top; }
+	void ClearDirty() { Dirty.left = Dirty.top = Dirty.right = Dirty.bottom = 0; }
 };
 
 // texture management
@@ -234,6 +252,8 @@ class CTexMgr
 {
 public:
 	std::list<CTexRef *> Textures;
+	// texture uploads since the last ResetUploadStats
+	size_t iUploadedBytes, iUploadCount;
 
 public:
 	CTexMgr();
@@ -244,6 +264,8 @@ public:
 
 	void IntLock(); // do an internal lock
 	void IntUnlock(); // undo internal lock
+
+	void ResetUploadStats() { iUploadedBytes = iUploadCount = 0; }
 };
 
 extern CTexMgr *pTexMgr;
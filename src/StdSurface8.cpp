@@ -299,9 +299,9 @@ static CPolyEdge *remove_edge(CPolyEdge *list, CPolyEdge *edge)
 	else return edge->next;
 }
 
-// Global polygon quick buffer
+// Polygon quick buffer; per thread, so polygons can be drawn concurrently
 const int QuickPolyBufSize = 20;
-CPolyEdge QuickPolyBuf[QuickPolyBufSize];
+thread_local CPolyEdge QuickPolyBuf[QuickPolyBufSize];
 
 void CSurface8::Polygon(int iNum, int *ipVtx, int iCol)
 {
@@ -488,6 +488,7 @@ int main(int argc, char *argv[])
 	// Init C4Group
 	C4Group_SetMaker(Config.General.Name);
 	C4Group_SetTempPath(Config.General.TempPath);
+	C4Group_SetCompressionThreads(Config.General.WorkerThreads);
 	C4Group_SetSortList(C4CFN_FLS);
 
 	// Display current working directory